@@ -25,24 +25,66 @@
 
 GRUB_MOD_LICENSE ("GPLv3+");
 
+static void
+print_ratio (unsigned long hits, unsigned long misses)
+{
+  unsigned long ratio = 0;
+
+  if (hits + misses)
+    ratio = hits * 10000 / (hits + misses);
+  grub_printf ("%lu.%02lu%%", ratio / 100, ratio % 100);
+}
+
 static grub_err_t
 grub_rescue_cmd_info (struct grub_command *cmd __attribute__ ((unused)),
     int argc __attribute__ ((unused)),
     char *argv[] __attribute__ ((unused)))
 {
-  unsigned long hits, misses;
+  unsigned long hits = 0, misses = 0, evictions = 0;
+  unsigned i, used = 0;
+
+  for (i = 0; i < grub_disk_cache_sets * GRUB_DISK_CACHE_WAYS; i++)
+    if (grub_disk_cache_table[i].data)
+      used++;
+  grub_printf_ (N_("Disk cache: %u sets of %u blocks, %u in use\n"),
+		grub_disk_cache_sets, GRUB_DISK_CACHE_WAYS, used);
+
+  for (i = 0; i < GRUB_DISK_CACHE_STATS_MAX; i++)
+    {
+      struct grub_disk_cache_stats *stats = &grub_disk_cache_stats[i];
+      grub_disk_dev_t dev;
+      const char *name = "?";
+
+      if (!stats->used)
+	continue;
+
+      for (dev = grub_disk_dev_list; dev; dev = dev->next)
+	if (dev->id == stats->dev_id)
+	  name = dev->name;
+
+      if (i == GRUB_DISK_CACHE_STATS_MAX - 1)
+	grub_printf ("%-12s %-6s ", _("others"), "");
+      else
+	grub_printf ("%-12s %-6lu ", name, stats->disk_id);
+      grub_printf_ (N_("hits = %lu, misses = %lu, evictions = %lu ("),
+		    stats->hits, stats->misses, stats->evictions);
+      print_ratio (stats->hits, stats->misses);
+      grub_printf (")\n");
+
+      hits += stats->hits;
+      misses += stats->misses;
+      evictions += stats->evictions;
+    }
 
-  grub_disk_cache_get_performance (&hits, &misses);
   if (hits + misses)
     {
-      unsigned long ratio = hits * 10000 / (hits + misses);
-      grub_printf ("(%lu.%lu%%)\n", ratio / 100, ratio % 100);
-      grub_printf_ (N_("Disk cache statistics: hits = %lu (%lu.%02lu%%),"
-		     " misses = %lu\n"), ratio / 100, ratio % 100,
-		    hits, misses);
+      grub_printf_ (N_("Disk cache statistics: hits = %lu, misses = %lu,"
+		       " evictions = %lu ("), hits, misses, evictions);
+      print_ratio (hits, misses);
+      grub_printf (")\n");
     }
   else
-    grub_printf ("%s\n", _("No disk cache statistics available\n"));    
+    grub_printf ("%s\n", _("No disk cache statistics available\n"));
 
  return 0;
 }
@@ -53,21 +53,18 @@ static inline int GF_PER_SECTOR (const struct grub_cryptodisk *dev)
 static grub_cryptodisk_t cryptodisk_list = NULL;
 static grub_uint8_t last_cryptodisk_id = 0;
 
+/* The XTS tweak is a little endian 128-bit number.  */
 static void
-gf_mul_x (grub_uint8_t *g)
+gf_mul_x (grub_uint64_t *g)
 {
-  int over = 0, over2 = 0;
-  unsigned j;
-
-  for (j = 0; j < GRUB_CRYPTODISK_GF_BYTES; j++)
-    {
-      over2 = !!(g[j] & 0x80);
-      g[j] <<= 1;
-      g[j] |= over;
-      over = over2;
-    }
-  if (over)
-    g[0] ^= GF_POLYNOM;
+  grub_uint64_t lo = grub_le_to_cpu64 (g[0]);
+  grub_uint64_t hi = grub_le_to_cpu64 (g[1]);
+  grub_uint64_t over = hi >> 63;
+
+  hi = (hi << 1) | (lo >> 63);
+  lo = (lo << 1) ^ (-over & GF_POLYNOM);
+  g[0] = grub_cpu_to_le64 (lo);
+  g[1] = grub_cpu_to_le64 (hi);
 }
 
 
@@ -220,42 +217,25 @@ lrw_xor (const struct lrw_sector *sec,
 		   dev->lrw_precalc, sec->low_byte * GRUB_CRYPTODISK_GF_BYTES);
 }
 
+/* IVs are generated for up to this many sectors at a time.  */
+#define IV_BATCH 32
+#define IV_WORDS ((GRUB_CRYPTO_MAX_CIPHER_BLOCKSIZE + 3) / 4)
+
 static gcry_err_code_t
-grub_cryptodisk_endecrypt (struct grub_cryptodisk *dev,
-			   grub_uint8_t * data, grub_size_t len,
-			   grub_disk_addr_t sector, int do_encrypt)
+generate_ivs (struct grub_cryptodisk *dev, grub_uint32_t (*ivs)[IV_WORDS],
+	      grub_disk_addr_t sector, unsigned n)
 {
-  grub_size_t i;
-  gcry_err_code_t err;
+  grub_size_t sz = ((dev->cipher->cipher->blocksize
+		     + sizeof (grub_uint32_t) - 1)
+		    / sizeof (grub_uint32_t));
+  unsigned k;
 
-  if (dev->cipher->cipher->blocksize > GRUB_CRYPTO_MAX_CIPHER_BLOCKSIZE)
-    return GPG_ERR_INV_ARG;
-
-  /* The only mode without IV.  */
-  if (dev->mode == GRUB_CRYPTODISK_MODE_ECB && !dev->rekey)
-    return (do_encrypt ? grub_crypto_ecb_encrypt (dev->cipher, data, data, len)
-	    : grub_crypto_ecb_decrypt (dev->cipher, data, data, len));
+  grub_memset (ivs, 0, n * sizeof (ivs[0]));
 
-  for (i = 0; i < len; i += (1U << dev->log_sector_size))
+  for (k = 0; k < n; k++, sector++)
     {
-      grub_size_t sz = ((dev->cipher->cipher->blocksize
-			 + sizeof (grub_uint32_t) - 1)
-			/ sizeof (grub_uint32_t));
-      grub_uint32_t iv[(GRUB_CRYPTO_MAX_CIPHER_BLOCKSIZE + 3) / 4];
-
-      if (dev->rekey)
-	{
-	  grub_uint64_t zone = sector >> dev->rekey_shift;
-	  if (zone != dev->last_rekey)
-	    {
-	      err = dev->rekey (dev, zone);
-	      if (err)
-		return err;
-	      dev->last_rekey = zone;
-	    }
-	}
+      grub_uint32_t *iv = ivs[k];
 
-      grub_memset (iv, 0, sizeof (iv));
       switch (dev->mode_iv)
 	{
 	case GRUB_CRYPTODISK_MODE_IV_NULL:
@@ -263,24 +243,21 @@ grub_cryptodisk_endecrypt (struct grub_cryptodisk *dev,
 	case GRUB_CRYPTODISK_MODE_IV_BYTECOUNT64_HASH:
 	  {
 	    grub_uint64_t tmp;
-	    void *ctx;
-
-	    ctx = grub_zalloc (dev->iv_hash->contextsize);
-	    if (!ctx)
-	      return GPG_ERR_OUT_OF_MEMORY;
+	    grub_size_t ctxsize = dev->iv_hash->contextsize;
+	    grub_uint8_t *ctx = (grub_uint8_t *) dev->iv_hash_ctx + ctxsize;
 
+	    /* Continue from the state after the prefix.  */
+	    grub_memcpy (ctx, dev->iv_hash_ctx, ctxsize);
 	    tmp = grub_cpu_to_le64 (sector << dev->log_sector_size);
-	    dev->iv_hash->init (ctx);
-	    dev->iv_hash->write (ctx, dev->iv_prefix, dev->iv_prefix_len);
 	    dev->iv_hash->write (ctx, &tmp, sizeof (tmp));
 	    dev->iv_hash->final (ctx);
 
-	    grub_memcpy (iv, dev->iv_hash->read (ctx), sizeof (iv));
-	    grub_free (ctx);
+	    grub_memcpy (iv, dev->iv_hash->read (ctx), sizeof (ivs[0]));
 	  }
 	  break;
 	case GRUB_CRYPTODISK_MODE_IV_PLAIN64:
 	  iv[1] = grub_cpu_to_le32 (sector >> 32);
+	  /* Fallthrough.  */
 	case GRUB_CRYPTODISK_MODE_IV_PLAIN:
 	  iv[0] = grub_cpu_to_le32 (sector & 0xFFFFFFFF);
 	  break;
@@ -298,98 +275,209 @@ grub_cryptodisk_endecrypt (struct grub_cryptodisk *dev,
 	  break;
 	case GRUB_CRYPTODISK_MODE_IV_ESSIV:
 	  iv[0] = grub_cpu_to_le32 (sector & 0xFFFFFFFF);
-	  err = grub_crypto_ecb_encrypt (dev->essiv_cipher, iv, iv,
+	  break;
+	}
+    }
+
+  if (dev->mode_iv == GRUB_CRYPTODISK_MODE_IV_ESSIV)
+    {
+      gcry_err_code_t err;
+
+      /* With a full width block size the IVs are contiguous.  */
+      if (dev->cipher->cipher->blocksize == sizeof (ivs[0]))
+	return grub_crypto_ecb_encrypt (dev->essiv_cipher, ivs, ivs,
+					n * sizeof (ivs[0]));
+      for (k = 0; k < n; k++)
+	{
+	  err = grub_crypto_ecb_encrypt (dev->essiv_cipher, ivs[k], ivs[k],
 					 dev->cipher->cipher->blocksize);
 	  if (err)
 	    return err;
 	}
+    }
+
+  return GPG_ERR_NO_ERROR;
+}
+
+/* En- or decrypt one XTS sector, TWEAK is the already encrypted IV.  */
+static gcry_err_code_t
+xts_sector (struct grub_cryptodisk *dev, grub_uint8_t *data,
+	    const grub_uint32_t *tweak, int do_encrypt)
+{
+  gcry_cipher_encrypt_t fn;
+  grub_uint64_t t[2];
+  unsigned j;
+
+  fn = do_encrypt ? dev->cipher->cipher->encrypt : dev->cipher->cipher->decrypt;
+  if (!fn)
+    return GPG_ERR_NOT_SUPPORTED;
+
+  grub_memcpy (t, tweak, sizeof (t));
+  for (j = 0; j < (1U << dev->log_sector_size); j += sizeof (t))
+    {
+      grub_crypto_xor (data + j, data + j, t, sizeof (t));
+      fn (dev->cipher->ctx, data + j, data + j);
+      grub_crypto_xor (data + j, data + j, t, sizeof (t));
+      gf_mul_x (t);
+    }
+
+  return GPG_ERR_NO_ERROR;
+}
+
+static gcry_err_code_t
+grub_cryptodisk_endecrypt (struct grub_cryptodisk *dev,
+			   grub_uint8_t * data, grub_size_t len,
+			   grub_disk_addr_t sector, int do_encrypt)
+{
+  grub_size_t i;
+  gcry_err_code_t err;
+  grub_uint64_t ivbuf[IV_BATCH * IV_WORDS / 2];
+  grub_uint32_t (*ivs)[IV_WORDS] = (void *) ivbuf;
+
+  if (dev->cipher->cipher->blocksize > GRUB_CRYPTO_MAX_CIPHER_BLOCKSIZE)
+    return GPG_ERR_INV_ARG;
+
+  /* The only mode without IV.  */
+  if (dev->mode == GRUB_CRYPTODISK_MODE_ECB && !dev->rekey)
+    return (do_encrypt ? grub_crypto_ecb_encrypt (dev->cipher, data, data, len)
+	    : grub_crypto_ecb_decrypt (dev->cipher, data, data, len));
+
+  if (dev->mode == GRUB_CRYPTODISK_MODE_XTS
+      && dev->cipher->cipher->blocksize != GRUB_CRYPTODISK_GF_BYTES)
+    return GPG_ERR_INV_ARG;
+
+  if (dev->mode_iv == GRUB_CRYPTODISK_MODE_IV_BYTECOUNT64_HASH)
+    {
+      /* Hash the prefix once, the context is kept with the device.  */
+      if (!dev->iv_hash_ctx)
+	{
+	  dev->iv_hash_ctx = grub_malloc (2 * dev->iv_hash->contextsize);
+	  if (!dev->iv_hash_ctx)
+	    return GPG_ERR_OUT_OF_MEMORY;
+	}
+      dev->iv_hash->init (dev->iv_hash_ctx);
+      dev->iv_hash->write (dev->iv_hash_ctx, dev->iv_prefix,
+			   dev->iv_prefix_len);
+    }
+
+  for (i = 0; i < len; )
+    {
+      grub_size_t n = ((len - i + (1U << dev->log_sector_size) - 1)
+		       >> dev->log_sector_size);
+      unsigned k;
+
+      if (n > IV_BATCH)
+	n = IV_BATCH;
+
+      if (dev->rekey)
+	{
+	  grub_uint64_t zone = sector >> dev->rekey_shift;
+	  grub_uint64_t left;
+
+	  if (zone != dev->last_rekey)
+	    {
+	      err = dev->rekey (dev, zone);
+	      if (err)
+		return err;
+	      dev->last_rekey = zone;
+	    }
+
+	  /* Don't run into the next zone.  */
+	  left = ((zone + 1) << dev->rekey_shift) - sector;
+	  if (n > left)
+	    n = left;
+	}
+
+      err = generate_ivs (dev, ivs, sector, n);
+      if (err)
+	return err;
 
       switch (dev->mode)
 	{
-	case GRUB_CRYPTODISK_MODE_CBC:
+	case GRUB_CRYPTODISK_MODE_ECB:
 	  if (do_encrypt)
-	    err = grub_crypto_cbc_encrypt (dev->cipher, data + i, data + i,
-					   (1U << dev->log_sector_size), iv);
+	    err = grub_crypto_ecb_encrypt (dev->cipher, data + i, data + i,
+					   n << dev->log_sector_size);
 	  else
-	    err = grub_crypto_cbc_decrypt (dev->cipher, data + i, data + i,
-					   (1U << dev->log_sector_size), iv);
+	    err = grub_crypto_ecb_decrypt (dev->cipher, data + i, data + i,
+					   n << dev->log_sector_size);
 	  if (err)
 	    return err;
 	  break;
 
-	case GRUB_CRYPTODISK_MODE_PCBC:
-	  if (do_encrypt)
-	    err = grub_crypto_pcbc_encrypt (dev->cipher, data + i, data + i,
-					    (1U << dev->log_sector_size), iv);
-	  else
-	    err = grub_crypto_pcbc_decrypt (dev->cipher, data + i, data + i,
-					    (1U << dev->log_sector_size), iv);
-	  if (err)
-	    return err;
-	  break;
 	case GRUB_CRYPTODISK_MODE_XTS:
-	  {
-	    unsigned j;
-	    err = grub_crypto_ecb_encrypt (dev->secondary_cipher, iv, iv,
-					   dev->cipher->cipher->blocksize);
-	    if (err)
-	      return err;
-	    
-	    for (j = 0; j < (1U << dev->log_sector_size);
-		 j += dev->cipher->cipher->blocksize)
-	      {
-		grub_crypto_xor (data + i + j, data + i + j, iv,
-				 dev->cipher->cipher->blocksize);
-		if (do_encrypt)
-		  err = grub_crypto_ecb_encrypt (dev->cipher, data + i + j, 
-						 data + i + j,
-						 dev->cipher->cipher->blocksize);
-		else
-		  err = grub_crypto_ecb_decrypt (dev->cipher, data + i + j, 
-						 data + i + j,
-						 dev->cipher->cipher->blocksize);
-		if (err)
-		  return err;
-		grub_crypto_xor (data + i + j, data + i + j, iv,
-				 dev->cipher->cipher->blocksize);
-		gf_mul_x ((grub_uint8_t *) iv);
-	      }
-	  }
-	  break;
-	case GRUB_CRYPTODISK_MODE_LRW:
-	  {
-	    struct lrw_sector sec;
-
-	    generate_lrw_sector (&sec, dev, (grub_uint8_t *) iv);
-	    lrw_xor (&sec, dev, data + i);
-
-	    if (do_encrypt)
-	      err = grub_crypto_ecb_encrypt (dev->cipher, data + i, 
-					     data + i,
-					     (1U << dev->log_sector_size));
-	    else
-	      err = grub_crypto_ecb_decrypt (dev->cipher, data + i, 
-					     data + i,
-					     (1U << dev->log_sector_size));
-	    if (err)
-	      return err;
-	    lrw_xor (&sec, dev, data + i);
-	  }
-	  break;
-	case GRUB_CRYPTODISK_MODE_ECB:
-	  if (do_encrypt)
-	    err = grub_crypto_ecb_encrypt (dev->cipher, data + i, data + i,
-					   (1U << dev->log_sector_size));
-	  else
-	    err = grub_crypto_ecb_decrypt (dev->cipher, data + i, data + i,
-					   (1U << dev->log_sector_size));
+	  err = grub_crypto_ecb_encrypt (dev->secondary_cipher, ivs, ivs,
+					 n * sizeof (ivs[0]));
 	  if (err)
 	    return err;
+	  for (k = 0; k < n; k++)
+	    {
+	      err = xts_sector (dev, data + i + (k << dev->log_sector_size),
+				ivs[k], do_encrypt);
+	      if (err)
+		return err;
+	    }
 	  break;
+
 	default:
-	  return GPG_ERR_NOT_IMPLEMENTED;
+	  for (k = 0; k < n; k++)
+	    {
+	      grub_uint8_t *sec = data + i + (k << dev->log_sector_size);
+	      grub_uint32_t *iv = ivs[k];
+
+	      switch (dev->mode)
+		{
+		case GRUB_CRYPTODISK_MODE_CBC:
+		  if (do_encrypt)
+		    err = grub_crypto_cbc_encrypt (dev->cipher, sec, sec,
+						   (1U << dev->log_sector_size),
+						   iv);
+		  else
+		    err = grub_crypto_cbc_decrypt (dev->cipher, sec, sec,
+						   (1U << dev->log_sector_size),
+						   iv);
+		  break;
+
+		case GRUB_CRYPTODISK_MODE_PCBC:
+		  if (do_encrypt)
+		    err = grub_crypto_pcbc_encrypt (dev->cipher, sec, sec,
+						    (1U << dev->log_sector_size),
+						    iv);
+		  else
+		    err = grub_crypto_pcbc_decrypt (dev->cipher, sec, sec,
+						    (1U << dev->log_sector_size),
+						    iv);
+		  break;
+
+		case GRUB_CRYPTODISK_MODE_LRW:
+		  {
+		    struct lrw_sector lrw;
+
+		    generate_lrw_sector (&lrw, dev, (grub_uint8_t *) iv);
+		    lrw_xor (&lrw, dev, sec);
+
+		    if (do_encrypt)
+		      err = grub_crypto_ecb_encrypt (dev->cipher, sec, sec,
+						     (1U << dev->log_sector_size));
+		    else
+		      err = grub_crypto_ecb_decrypt (dev->cipher, sec, sec,
+						     (1U << dev->log_sector_size));
+		    if (err)
+		      return err;
+		    lrw_xor (&lrw, dev, sec);
+		  }
+		  break;
+
+		default:
+		  return GPG_ERR_NOT_IMPLEMENTED;
+		}
+	      if (err)
+		return err;
+	    }
 	}
-      sector++;
+
+      i += n << dev->log_sector_size;
+      sector += n;
     }
   return GPG_ERR_NO_ERROR;
 }
@@ -810,6 +898,7 @@ cryptodisk_close (grub_cryptodisk_t dev)
   grub_crypto_cipher_close (dev->cipher);
   grub_crypto_cipher_close (dev->secondary_cipher);
   grub_crypto_cipher_close (dev->essiv_cipher);
+  grub_free (dev->iv_hash_ctx);
   grub_free (dev);
 }
 
@@ -319,6 +319,7 @@ configure_ciphers (grub_disk_t disk, const char *check_uuid,
     }
 
   ciphername = algorithms[grub_le_to_cpu16 (header.alg)];
+  grub_cryptodisk_request_crypto (ciphername);
   ciph = grub_crypto_lookup_cipher_by_name (ciphername);
   if (!ciph)
     {
@@ -377,7 +378,11 @@ configure_ciphers (grub_disk_t disk, const char *check_uuid,
   newdev->essiv_cipher = NULL;
   newdev->essiv_hash = NULL;
   newdev->hash = GRUB_MD_SHA512;
-  newdev->iv_hash = GRUB_MD_SHA256;
+  /* Per sector, so prefer sha_hw if it registered over gcry_sha256.  */
+  grub_cryptodisk_request_crypto ("sha256");
+  newdev->iv_hash = grub_crypto_lookup_md_by_name ("sha256");
+  if (!newdev->iv_hash)
+    newdev->iv_hash = GRUB_MD_SHA256;
 
   for (newdev->log_sector_size = 0;
        (1U << newdev->log_sector_size) < grub_le_to_cpu32 (header.sector_size);
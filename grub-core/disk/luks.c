@@ -126,6 +126,7 @@ configure_ciphers (grub_disk_t disk, const char *check_uuid,
   grub_memcpy (hashspec, header.hashSpec, sizeof (header.hashSpec));
   hashspec[sizeof (header.hashSpec)] = 0;
 
+  grub_cryptodisk_request_crypto (ciphername);
   ciph = grub_crypto_lookup_cipher_by_name (ciphername);
   if (!ciph)
     {
@@ -243,6 +244,7 @@ configure_ciphers (grub_disk_t disk, const char *check_uuid,
       mode_iv = GRUB_CRYPTODISK_MODE_IV_ESSIV;
 
       /* Configure the hash and cipher used for ESSIV.  */
+      grub_cryptodisk_request_crypto (hash_str);
       essiv_hash = grub_crypto_lookup_md_by_name (hash_str);
       if (!essiv_hash)
 	{
@@ -270,6 +272,7 @@ configure_ciphers (grub_disk_t disk, const char *check_uuid,
     }
 
   /* Configure the hash used for the AF splitter and HMAC.  */
+  grub_cryptodisk_request_crypto (hashspec);
   hash = grub_crypto_lookup_md_by_name (hashspec);
   if (!hash)
     {
@@ -23,7 +23,6 @@
 #include <grub/err.h>
 #include <grub/misc.h>
 #include <grub/diskfilter.h>
-#include <grub/crypto.h>
 
 GRUB_MOD_LICENSE ("GPLv3+");
 
@@ -31,38 +30,48 @@ static grub_err_t
 grub_raid5_recover (struct grub_diskfilter_segment *array, int disknr,
                     char *buf, grub_disk_addr_t sector, grub_size_t size)
 {
-  char *buf2;
+  char *blocks;
+  char **src;
+  unsigned nsrc = 0;
   int i;
+  grub_err_t err = GRUB_ERR_NONE;
 
-  size <<= GRUB_DISK_SECTOR_BITS;
-  buf2 = grub_malloc (size);
-  if (!buf2)
-    return grub_errno;
+  if (disknr < 0 || disknr >= (int) array->node_count
+      || array->node_count < 2)
+    return grub_error (GRUB_ERR_BAD_DEVICE, "invalid RAID5 member");
 
-  grub_memset (buf, 0, size);
+  /* Read all the other members first and XOR them in a single pass.  */
+  size <<= GRUB_DISK_SECTOR_BITS;
+  blocks = grub_malloc (size * (array->node_count - 1));
+  src = grub_malloc (sizeof (src[0]) * (array->node_count - 1));
+  if (!blocks || !src)
+    {
+      err = grub_errno;
+      goto quit;
+    }
 
   for (i = 0; i < (int) array->node_count; i++)
     {
-      grub_err_t err;
-
       if (i == disknr)
         continue;
 
+      src[nsrc] = blocks + nsrc * size;
       err = grub_diskfilter_read_node (&array->nodes[i], sector,
-				       size >> GRUB_DISK_SECTOR_BITS, buf2);
-
+				       size >> GRUB_DISK_SECTOR_BITS,
+				       src[nsrc]);
       if (err)
-        {
-          grub_free (buf2);
-          return err;
-        }
-
-      grub_crypto_xor (buf, buf, buf2, size);
+        goto quit;
+      nsrc++;
     }
 
-  grub_free (buf2);
+  grub_raid_xor (src[0], src, nsrc, size);
+  grub_memcpy (buf, src[0], size);
+
+quit:
+  grub_free (src);
+  grub_free (blocks);
 
-  return GRUB_ERR_NONE;
+  return err;
 }
 
 GRUB_MOD_INIT(raid5rec)
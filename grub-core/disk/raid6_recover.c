@@ -23,7 +23,6 @@
 #include <grub/err.h>
 #include <grub/misc.h>
 #include <grub/diskfilter.h>
-#include <grub/crypto.h>
 
 GRUB_MOD_LICENSE ("GPLv3+");
 
@@ -33,18 +32,6 @@ static grub_uint8_t powx[255 * 2];
 static unsigned powx_inv[256];
 static const grub_uint8_t poly = 0x1d;
 
-static void
-grub_raid_block_mulx (unsigned mul, char *buf, grub_size_t size)
-{
-  grub_size_t i;
-  grub_uint8_t *p;
-
-  p = (grub_uint8_t *) buf;
-  for (i = 0; i < size; i++, p++)
-    if (*p)
-      *p = powx[mul + powx_inv[*p]];
-}
-
 static void
 grub_raid6_init_table (void)
 {
@@ -73,32 +60,49 @@ mod_255 (unsigned x)
   return x;
 }
 
+/* DST ^= SRC.  */
+static void
+xor_into (char *dst, char *src, grub_size_t size)
+{
+  char *blocks[2] = { dst, src };
+
+  grub_raid_xor (dst, blocks, 2, size);
+}
+
 static grub_err_t
 grub_raid6_recover (struct grub_diskfilter_segment *array, int disknr, int p,
                     char *buf, grub_disk_addr_t sector, grub_size_t size)
 {
   int i, q, pos;
   int bad1 = -1, bad2 = -1;
-  char *pbuf = 0, *qbuf = 0;
+  int n = array->node_count;
+  char *blocks = 0, *pbuf, *qbuf;
+  char **data = 0;
 
   size <<= GRUB_DISK_SECTOR_BITS;
-  pbuf = grub_zalloc (size);
-  if (!pbuf)
+
+  /* All the members needed are read before any arithmetic, each into its
+     own block, followed by two for the syndromes of the data read.  */
+  blocks = grub_malloc (size * (n + 2));
+  if (!blocks)
     goto quit;
+  pbuf = blocks + n * size;
+  qbuf = pbuf + size;
 
-  qbuf = grub_zalloc (size);
-  if (!qbuf)
+  /* Indexed by the coefficient of the member.  */
+  data = grub_zalloc (sizeof (data[0]) * n);
+  if (!data)
     goto quit;
 
   q = p + 1;
-  if (q == (int) array->node_count)
+  if (q == n)
     q = 0;
 
   pos = q + 1;
-  if (pos == (int) array->node_count)
+  if (pos == n)
     pos = 0;
 
-  for (i = 0; i < (int) array->node_count - 2; i++)
+  for (i = 0; i < n - 2; i++)
     {
       int c;
       if (array->layout & GRUB_RAID_LAYOUT_MUL_FROM_POS)
@@ -110,12 +114,9 @@ grub_raid6_recover (struct grub_diskfilter_segment *array, int disknr, int p,
       else
         {
           if (! grub_diskfilter_read_node (&array->nodes[pos], sector,
-					   size >> GRUB_DISK_SECTOR_BITS, buf))
-            {
-              grub_crypto_xor (pbuf, pbuf, buf, size);
-              grub_raid_block_mulx (c, buf, size);
-              grub_crypto_xor (qbuf, qbuf, buf, size);
-            }
+					   size >> GRUB_DISK_SECTOR_BITS,
+					   blocks + pos * size))
+	    data[c] = blocks + pos * size;
           else
             {
               /* Too many bad devices */
@@ -128,7 +129,7 @@ grub_raid6_recover (struct grub_diskfilter_segment *array, int disknr, int p,
         }
 
       pos++;
-      if (pos == (int) array->node_count)
+      if (pos == n)
         pos = 0;
     }
 
@@ -140,20 +141,32 @@ grub_raid6_recover (struct grub_diskfilter_segment *array, int disknr, int p,
     {
       /* One bad device */
       if ((! grub_diskfilter_read_node (&array->nodes[p], sector,
-					size >> GRUB_DISK_SECTOR_BITS, buf)))
+					size >> GRUB_DISK_SECTOR_BITS,
+					blocks + p * size)))
         {
-          grub_crypto_xor (buf, buf, pbuf, size);
+	  char **src = data;
+	  unsigned nsrc = 0;
+
+	  /* The data read and P, in place of the missing one.  */
+	  data[bad1] = blocks + p * size;
+	  for (i = 0; i < n; i++)
+	    if (data[i])
+	      src[nsrc++] = data[i];
+	  grub_raid_xor (pbuf, src, nsrc, size);
+	  grub_memcpy (buf, pbuf, size);
           goto quit;
         }
 
       grub_errno = GRUB_ERR_NONE;
       if (grub_diskfilter_read_node (&array->nodes[q], sector,
-				     size >> GRUB_DISK_SECTOR_BITS, buf))
+				     size >> GRUB_DISK_SECTOR_BITS,
+				     blocks + q * size))
         goto quit;
 
-      grub_crypto_xor (buf, buf, qbuf, size);
-      grub_raid_block_mulx (255 - bad1, buf,
-                           size);
+      grub_raid6_syndrome (data, n, NULL, qbuf, size);
+      xor_into (qbuf, blocks + q * size, size);
+      grub_raid6_mul (powx[255 - bad1], qbuf, size);
+      grub_memcpy (buf, qbuf, size);
     }
   else
     {
@@ -161,31 +174,33 @@ grub_raid6_recover (struct grub_diskfilter_segment *array, int disknr, int p,
       unsigned c;
 
       if (grub_diskfilter_read_node (&array->nodes[p], sector,
-				     size >> GRUB_DISK_SECTOR_BITS, buf))
+				     size >> GRUB_DISK_SECTOR_BITS,
+				     blocks + p * size))
         goto quit;
 
-      grub_crypto_xor (pbuf, pbuf, buf, size);
-
       if (grub_diskfilter_read_node (&array->nodes[q], sector,
-				     size >> GRUB_DISK_SECTOR_BITS, buf))
+				     size >> GRUB_DISK_SECTOR_BITS,
+				     blocks + q * size))
         goto quit;
 
-      grub_crypto_xor (qbuf, qbuf, buf, size);
+      grub_raid6_syndrome (data, n, pbuf, qbuf, size);
+      xor_into (pbuf, blocks + p * size, size);
+      xor_into (qbuf, blocks + q * size, size);
 
       c = mod_255((255 ^ bad1)
 		  + (255 ^ powx_inv[(powx[bad2 + (bad1 ^ 255)] ^ 1)]));
-      grub_raid_block_mulx (c, qbuf, size);
+      grub_raid6_mul (powx[c], qbuf, size);
 
       c = mod_255((unsigned) bad2 + c);
-      grub_raid_block_mulx (c, pbuf, size);
+      grub_raid6_mul (powx[c], pbuf, size);
 
-      grub_crypto_xor (pbuf, pbuf, qbuf, size);
+      xor_into (pbuf, qbuf, size);
       grub_memcpy (buf, pbuf, size);
     }
 
 quit:
-  grub_free (pbuf);
-  grub_free (qbuf);
+  grub_free (blocks);
+  grub_free (data);
 
   return grub_errno;
 }
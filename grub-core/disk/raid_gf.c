@@ -0,0 +1,370 @@
+/* raid_gf.c - XOR and GF(2^8) block arithmetic for RAID5/RAID6 recovery.  */
+/*
+ *  GRUB  --  GRand Unified Bootloader
+ *  Copyright (C) 2024  Free Software Foundation, Inc.
+ *
+ *  GRUB is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  GRUB is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with GRUB.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <grub/dl.h>
+#include <grub/misc.h>
+#include <grub/disk.h>
+#include <grub/diskfilter.h>
+#if defined (__x86_64__) && defined (GRUB_MACHINE_EFI)
+#include <grub/i386/cpuid.h>
+#endif
+
+GRUB_MOD_LICENSE ("GPLv3+");
+
+/* The members are combined a slice at a time, so that the slice of the
+   result stays in the cache while every member is added to it.  */
+#define SLICE_SIZE	4096
+
+/* Stands in for missing members.  */
+static char zero_slice[SLICE_SIZE];
+
+/* The RAID6 generator polynomial, x^8 + x^4 + x^3 + x^2 + 1.  */
+static const grub_uint8_t poly = 0x1d;
+
+static grub_uint8_t
+gf_mul_byte (grub_uint8_t a, grub_uint8_t b)
+{
+  grub_uint8_t r = 0;
+
+  for (; b; b >>= 1)
+    {
+      if (b & 1)
+	r ^= a;
+      a = (a << 1) ^ ((a & 0x80) ? poly : 0);
+    }
+  return r;
+}
+
+typedef unsigned long gf_word_t;
+
+#define GF_BYTES(x)	(((gf_word_t) -1 / 0xff) * (x))
+
+#if !defined (__aarch64__) || !defined (GRUB_MACHINE_EFI)
+/* A byte at a time through a table of all the products.  */
+static void
+mul_block_table (const grub_uint8_t *lo, const grub_uint8_t *hi,
+		 char *buf, grub_size_t len)
+{
+  grub_uint8_t table[256];
+  grub_uint8_t *p = (grub_uint8_t *) buf;
+  unsigned i;
+
+  for (i = 0; i < 256; i++)
+    table[i] = lo[i & 0xf] ^ hi[i >> 4];
+  for (; len; len--, p++)
+    *p = table[*p];
+}
+#endif
+
+#if defined (__x86_64__) && defined (GRUB_MACHINE_EFI)
+
+/* SSE2 is always there on x86_64 and UEFI has it enabled. Only xmm0-xmm5
+   are used, the firmware calling convention has the others callee saved.
+   LEN is a multiple of 32.  */
+
+static void
+xor_block (char *dst, const char *src, grub_size_t len)
+{
+  asm volatile ("1:\n\t"
+		"movdqu (%[dst]), %%xmm0\n\t"
+		"movdqu 16(%[dst]), %%xmm1\n\t"
+		"movdqu (%[src]), %%xmm2\n\t"
+		"movdqu 16(%[src]), %%xmm3\n\t"
+		"pxor %%xmm2, %%xmm0\n\t"
+		"pxor %%xmm3, %%xmm1\n\t"
+		"movdqu %%xmm0, (%[dst])\n\t"
+		"movdqu %%xmm1, 16(%[dst])\n\t"
+		"add $32, %[src]\n\t"
+		"add $32, %[dst]\n\t"
+		"sub $32, %[len]\n\t"
+		"jnz 1b\n"
+		: [dst] "+r" (dst), [src] "+r" (src), [len] "+r" (len)
+		:
+		: "cc", "memory");
+}
+
+/* Doubling is an add of each byte to itself, with the bytes which had
+   the top bit set, found by comparing against zero, reduced.  */
+static void
+mul2_xor_block (char *q, const char *d, grub_size_t len)
+{
+  asm volatile ("movd %[poly], %%xmm0\n\t"
+		"pshufd $0, %%xmm0, %%xmm0\n"
+		"1:\n\t"
+		"movdqu (%[q]), %%xmm1\n\t"
+		"movdqu 16(%[q]), %%xmm4\n\t"
+		"pxor %%xmm2, %%xmm2\n\t"
+		"pxor %%xmm5, %%xmm5\n\t"
+		"pcmpgtb %%xmm1, %%xmm2\n\t"
+		"pcmpgtb %%xmm4, %%xmm5\n\t"
+		"paddb %%xmm1, %%xmm1\n\t"
+		"paddb %%xmm4, %%xmm4\n\t"
+		"pand %%xmm0, %%xmm2\n\t"
+		"pand %%xmm0, %%xmm5\n\t"
+		"pxor %%xmm2, %%xmm1\n\t"
+		"pxor %%xmm5, %%xmm4\n\t"
+		"movdqu (%[d]), %%xmm2\n\t"
+		"movdqu 16(%[d]), %%xmm5\n\t"
+		"pxor %%xmm2, %%xmm1\n\t"
+		"pxor %%xmm5, %%xmm4\n\t"
+		"movdqu %%xmm1, (%[q])\n\t"
+		"movdqu %%xmm4, 16(%[q])\n\t"
+		"add $32, %[d]\n\t"
+		"add $32, %[q]\n\t"
+		"sub $32, %[len]\n\t"
+		"jnz 1b\n"
+		: [q] "+r" (q), [d] "+r" (d), [len] "+r" (len)
+		: [poly] "r" ((grub_uint32_t) GF_BYTES (poly))
+		: "cc", "memory");
+}
+
+static int
+ssse3_supported (void)
+{
+  static int supported = -1;
+  grub_uint32_t eax, ebx, ecx, edx;
+
+  if (supported >= 0)
+    return supported;
+
+  supported = 0;
+  if (!grub_cpu_is_cpuid_supported ())
+    return 0;
+  grub_cpuid (0, eax, ebx, ecx, edx);
+  if (eax < 1)
+    return 0;
+  grub_cpuid (1, eax, ebx, ecx, edx);
+  supported = !!(ecx & (1 << 9));
+  return supported;
+}
+
+/* Multiply by a constant with PSHUFB looking up the products of the low
+   and high nibbles of 16 bytes at once.  */
+static void
+mul_block (const grub_uint8_t *lo, const grub_uint8_t *hi,
+	   char *buf, grub_size_t len)
+{
+  if (!ssse3_supported ())
+    {
+      mul_block_table (lo, hi, buf, len);
+      return;
+    }
+
+  asm volatile ("movdqu (%[lo]), %%xmm0\n\t"
+		"movdqu (%[hi]), %%xmm1\n\t"
+		"movd %[mask], %%xmm2\n\t"
+		"pshufd $0, %%xmm2, %%xmm2\n"
+		"1:\n\t"
+		"movdqu (%[buf]), %%xmm3\n\t"
+		"movdqa %%xmm3, %%xmm4\n\t"
+		"psrlw $4, %%xmm4\n\t"
+		"pand %%xmm2, %%xmm3\n\t"
+		"pand %%xmm2, %%xmm4\n\t"
+		"movdqa %%xmm0, %%xmm5\n\t"
+		"pshufb %%xmm3, %%xmm5\n\t"
+		"movdqa %%xmm1, %%xmm3\n\t"
+		"pshufb %%xmm4, %%xmm3\n\t"
+		"pxor %%xmm5, %%xmm3\n\t"
+		"movdqu %%xmm3, (%[buf])\n\t"
+		"add $16, %[buf]\n\t"
+		"sub $16, %[len]\n\t"
+		"jnz 1b\n"
+		: [buf] "+r" (buf), [len] "+r" (len)
+		: [lo] "r" (lo), [hi] "r" (hi), [mask] "r" (0x0f0f0f0f)
+		: "cc", "memory");
+}
+
+#elif defined (__aarch64__) && defined (GRUB_MACHINE_EFI)
+
+/* Advanced SIMD is part of ARMv8 and UEFI leaves it enabled. GRUB itself
+   is built without it, so it's only used here and only v0-v7, which are
+   caller saved. LEN is a multiple of 32.  */
+
+static void
+xor_block (char *dst, const char *src, grub_size_t len)
+{
+  asm volatile (".arch_extension simd\n"
+		"1:\n\t"
+		"ld1 {v0.16b, v1.16b}, [%[dst]]\n\t"
+		"ld1 {v2.16b, v3.16b}, [%[src]], #32\n\t"
+		"eor v0.16b, v0.16b, v2.16b\n\t"
+		"eor v1.16b, v1.16b, v3.16b\n\t"
+		"st1 {v0.16b, v1.16b}, [%[dst]], #32\n\t"
+		"subs %[len], %[len], #32\n\t"
+		"b.ne 1b\n"
+		: [dst] "+r" (dst), [src] "+r" (src), [len] "+r" (len)
+		:
+		: "cc", "memory");
+}
+
+static void
+mul2_xor_block (char *q, const char *d, grub_size_t len)
+{
+  asm volatile (".arch_extension simd\n\t"
+		"dup v4.16b, %w[poly]\n"
+		"1:\n\t"
+		"ld1 {v0.16b, v1.16b}, [%[q]]\n\t"
+		"ld1 {v2.16b, v3.16b}, [%[d]], #32\n\t"
+		"cmlt v5.16b, v0.16b, #0\n\t"
+		"cmlt v6.16b, v1.16b, #0\n\t"
+		"shl v0.16b, v0.16b, #1\n\t"
+		"shl v1.16b, v1.16b, #1\n\t"
+		"and v5.16b, v5.16b, v4.16b\n\t"
+		"and v6.16b, v6.16b, v4.16b\n\t"
+		"eor v0.16b, v0.16b, v5.16b\n\t"
+		"eor v1.16b, v1.16b, v6.16b\n\t"
+		"eor v0.16b, v0.16b, v2.16b\n\t"
+		"eor v1.16b, v1.16b, v3.16b\n\t"
+		"st1 {v0.16b, v1.16b}, [%[q]], #32\n\t"
+		"subs %[len], %[len], #32\n\t"
+		"b.ne 1b\n"
+		: [q] "+r" (q), [d] "+r" (d), [len] "+r" (len)
+		: [poly] "r" ((unsigned) poly)
+		: "cc", "memory");
+}
+
+static void
+mul_block (const grub_uint8_t *lo, const grub_uint8_t *hi,
+	   char *buf, grub_size_t len)
+{
+  asm volatile (".arch_extension simd\n\t"
+		"ld1 {v0.16b}, [%[lo]]\n\t"
+		"ld1 {v1.16b}, [%[hi]]\n\t"
+		"movi v2.16b, #0x0f\n"
+		"1:\n\t"
+		"ld1 {v3.16b}, [%[buf]]\n\t"
+		"ushr v4.16b, v3.16b, #4\n\t"
+		"and v3.16b, v3.16b, v2.16b\n\t"
+		"tbl v3.16b, {v0.16b}, v3.16b\n\t"
+		"tbl v4.16b, {v1.16b}, v4.16b\n\t"
+		"eor v3.16b, v3.16b, v4.16b\n\t"
+		"st1 {v3.16b}, [%[buf]], #16\n\t"
+		"subs %[len], %[len], #16\n\t"
+		"b.ne 1b\n"
+		: [buf] "+r" (buf), [len] "+r" (len)
+		: [lo] "r" (lo), [hi] "r" (hi)
+		: "cc", "memory");
+}
+
+#else
+
+/* Without SIMD, a machine word at a time.  */
+
+static void
+xor_block (char *dst, const char *src, grub_size_t len)
+{
+  gf_word_t *d = (void *) dst;
+  const gf_word_t *s = (const void *) src;
+
+  for (len /= sizeof (gf_word_t); len; len--)
+    *d++ ^= *s++;
+}
+
+/* Q = Q * x + D, in every byte.  */
+static void
+mul2_xor_block (char *q, const char *d, grub_size_t len)
+{
+  gf_word_t *qw = (void *) q;
+  const gf_word_t *dw = (const void *) d;
+
+  for (len /= sizeof (gf_word_t); len; len--)
+    {
+      gf_word_t v = *qw, hi;
+
+      /* 0xff in the bytes with the top bit set.  */
+      hi = v & GF_BYTES (0x80);
+      hi = (hi << 1) - (hi >> 7);
+      v = ((v << 1) & GF_BYTES (0xfe)) ^ (hi & GF_BYTES (poly));
+      *qw++ = v ^ *dw++;
+    }
+}
+
+#define mul_block	mul_block_table
+
+#endif
+
+void
+grub_raid_xor (char *dst, char **src, unsigned nsrc, grub_size_t size)
+{
+  grub_size_t off, len;
+  unsigned i;
+
+  for (off = 0; off < size; off += len)
+    {
+      len = size - off;
+      if (len > SLICE_SIZE)
+	len = SLICE_SIZE;
+
+      if (nsrc == 0)
+	{
+	  grub_memset (dst + off, 0, len);
+	  continue;
+	}
+      if (dst != src[0])
+	grub_memcpy (dst + off, src[0] + off, len);
+      for (i = 1; i < nsrc; i++)
+	xor_block (dst + off, src[i] + off, len);
+    }
+}
+
+void
+grub_raid6_syndrome (char **data, unsigned ndata, char *p, char *q,
+		     grub_size_t size)
+{
+  grub_size_t off, len;
+  unsigned i;
+
+  for (off = 0; off < size; off += len)
+    {
+      len = size - off;
+      if (len > SLICE_SIZE)
+	len = SLICE_SIZE;
+
+      if (p)
+	grub_memset (p + off, 0, len);
+      grub_memset (q + off, 0, len);
+
+      /* Horner's rule from the highest coefficient down.  */
+      for (i = ndata; i > 0; i--)
+	{
+	  const char *d = data[i - 1] ? data[i - 1] + off : zero_slice;
+
+	  if (p && d != zero_slice)
+	    xor_block (p + off, d, len);
+	  mul2_xor_block (q + off, d, len);
+	}
+    }
+}
+
+void
+grub_raid6_mul (grub_uint8_t factor, char *buf, grub_size_t size)
+{
+  grub_uint8_t lo[16], hi[16];
+  unsigned i;
+
+  if (factor == 1)
+    return;
+
+  for (i = 0; i < 16; i++)
+    {
+      lo[i] = gf_mul_byte (factor, i);
+      hi[i] = gf_mul_byte (factor, i << 4);
+    }
+  mul_block (lo, hi, buf, size);
+}
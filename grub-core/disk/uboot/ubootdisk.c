@@ -198,6 +198,11 @@ uboot_disk_open (const char *name, struct grub_disk *disk)
   else
     disk->total_sectors = GRUB_DISK_SIZE_UNKNOWN;
 
+  /* Every call goes through the U-Boot API and most storage drivers
+     behind it have a high per command cost, so allow full read-ahead
+     windows in a single call.  */
+  disk->max_agglomerate = GRUB_DISK_READAHEAD_MAX;
+
   disk->data = d;
 
   return GRUB_ERR_NONE;
@@ -105,6 +105,11 @@ struct grub_btrfs_data
   grub_uint64_t exttree;
   grub_size_t extsize;
   struct grub_btrfs_extent_data *extent;
+
+  /* Chunks read from the chunk tree, sorted by start.  */
+  struct grub_btrfs_chunk_desc *chunks;
+  unsigned n_chunks;
+  unsigned n_chunks_allocated;
 };
 
 struct grub_btrfs_chunk_item
@@ -131,6 +136,13 @@ struct grub_btrfs_chunk_stripe
   grub_btrfs_uuid_t device_uuid;
 } GRUB_PACKED;
 
+struct grub_btrfs_chunk_desc
+{
+  grub_uint64_t start;
+  grub_uint64_t size;
+  struct grub_btrfs_chunk_item *chunk;
+};
+
 struct grub_btrfs_leaf_node
 {
   struct grub_btrfs_key key;
@@ -606,6 +618,77 @@ find_device (struct grub_btrfs_data *data, grub_uint64_t id, int do_rescan)
   return ctx.dev_found;
 }
 
+/* Index of the first cached chunk starting after ADDR.  */
+static unsigned
+chunk_cache_upper (struct grub_btrfs_data *data, grub_uint64_t addr)
+{
+  unsigned lo = 0, hi = data->n_chunks;
+
+  while (lo < hi)
+    {
+      unsigned mid = lo + (hi - lo) / 2;
+      if (data->chunks[mid].start <= addr)
+	lo = mid + 1;
+      else
+	hi = mid;
+    }
+  return lo;
+}
+
+static struct grub_btrfs_chunk_desc *
+chunk_cache_find (struct grub_btrfs_data *data, grub_uint64_t addr)
+{
+  unsigned i = chunk_cache_upper (data, addr);
+  struct grub_btrfs_chunk_desc *desc;
+
+  if (i == 0)
+    return NULL;
+  desc = &data->chunks[i - 1];
+  if (addr - desc->start >= desc->size)
+    return NULL;
+  return desc;
+}
+
+/* Take over CHUNK, starting at START, into the cache. Returns the cached
+   copy, which is CHUNK unless that start was already there, or NULL if
+   out of memory in which case CHUNK stays with the caller.  */
+static struct grub_btrfs_chunk_item *
+chunk_cache_add (struct grub_btrfs_data *data, grub_uint64_t start,
+		 struct grub_btrfs_chunk_item *chunk)
+{
+  unsigned i = chunk_cache_upper (data, start);
+
+  if (i > 0 && data->chunks[i - 1].start == start)
+    {
+      grub_free (chunk);
+      return data->chunks[i - 1].chunk;
+    }
+
+  if (data->n_chunks == data->n_chunks_allocated)
+    {
+      struct grub_btrfs_chunk_desc *tmp;
+      unsigned n = data->n_chunks_allocated ? 2 * data->n_chunks_allocated
+	: 16;
+
+      tmp = grub_realloc (data->chunks, n * sizeof (data->chunks[0]));
+      if (!tmp)
+	{
+	  grub_errno = GRUB_ERR_NONE;
+	  return NULL;
+	}
+      data->chunks = tmp;
+      data->n_chunks_allocated = n;
+    }
+
+  grub_memmove (&data->chunks[i + 1], &data->chunks[i],
+		(data->n_chunks - i) * sizeof (data->chunks[0]));
+  data->chunks[i].start = start;
+  data->chunks[i].size = grub_le_to_cpu64 (chunk->size);
+  data->chunks[i].chunk = chunk;
+  data->n_chunks++;
+  return chunk;
+}
+
 static grub_err_t
 grub_btrfs_read_logical (struct grub_btrfs_data *data, grub_disk_addr_t addr,
 			 void *buf, grub_size_t size, int recursion_depth)
@@ -623,9 +706,21 @@ grub_btrfs_read_logical (struct grub_btrfs_data *data, grub_disk_addr_t addr,
       struct grub_btrfs_key key_in;
       grub_size_t chsize;
       grub_disk_addr_t chaddr;
+      grub_uint64_t chstart;
+      struct grub_btrfs_chunk_desc *desc;
+      struct grub_btrfs_chunk_item *cached;
 
       grub_dprintf ("btrfs", "searching for laddr %" PRIxGRUB_UINT64_T "\n",
 		    addr);
+
+      desc = chunk_cache_find (data, addr);
+      if (desc)
+	{
+	  chstart = desc->start;
+	  chunk = desc->chunk;
+	  goto chunk_found;
+	}
+
       for (ptr = data->sblock.bootstrap_mapping;
 	   ptr < data->sblock.bootstrap_mapping
 	   + sizeof (data->sblock.bootstrap_mapping)
@@ -639,9 +734,9 @@ grub_btrfs_read_logical (struct grub_btrfs_data *data, grub_disk_addr_t addr,
 			"%" PRIxGRUB_UINT64_T " %" PRIxGRUB_UINT64_T " \n",
 			grub_le_to_cpu64 (key->offset),
 			grub_le_to_cpu64 (chunk->size));
-	  if (grub_le_to_cpu64 (key->offset) <= addr
-	      && addr < grub_le_to_cpu64 (key->offset)
-	      + grub_le_to_cpu64 (chunk->size))
+	  chstart = grub_le_to_cpu64 (key->offset);
+	  if (chstart <= addr
+	      && addr < chstart + grub_le_to_cpu64 (chunk->size))
 	    goto chunk_found;
 	  ptr += sizeof (*key) + sizeof (*chunk)
 	    + sizeof (struct grub_btrfs_chunk_stripe)
@@ -667,6 +762,7 @@ grub_btrfs_read_logical (struct grub_btrfs_data *data, grub_disk_addr_t addr,
 	return grub_errno;
 
       challoc = 1;
+      chstart = grub_le_to_cpu64 (key->offset);
       err = grub_btrfs_read_logical (data, chaddr, chunk, chsize,
 				     recursion_depth);
       if (err)
@@ -675,11 +771,20 @@ grub_btrfs_read_logical (struct grub_btrfs_data *data, grub_disk_addr_t addr,
 	  return err;
 	}
 
+      /* Keep it for the next reads from the same chunk, which need no
+	 more tree lookups then.  */
+      cached = chunk_cache_add (data, chstart, chunk);
+      if (cached)
+	{
+	  chunk = cached;
+	  challoc = 0;
+	}
+
     chunk_found:
       {
 	grub_uint64_t stripen;
 	grub_uint64_t stripe_offset;
-	grub_uint64_t off = addr - grub_le_to_cpu64 (key->offset);
+	grub_uint64_t off = addr - chstart;
 	grub_uint64_t chunk_stripe_length;
 	grub_uint16_t nstripes;
 	unsigned redundancy = 1;
@@ -698,7 +803,7 @@ grub_btrfs_read_logical (struct grub_btrfs_data *data, grub_disk_addr_t addr,
 		      "+0x%" PRIxGRUB_UINT64_T
 		      " (%d stripes (%d substripes) of %"
 		      PRIxGRUB_UINT64_T ")\n",
-		      grub_le_to_cpu64 (key->offset),
+		      chstart,
 		      grub_le_to_cpu64 (chunk->size),
 		      nstripes,
 		      grub_le_to_cpu16 (chunk->nsubstripes),
@@ -797,7 +902,7 @@ grub_btrfs_read_logical (struct grub_btrfs_data *data, grub_disk_addr_t addr,
 			      " (%d stripes (%d substripes) of %"
 			      PRIxGRUB_UINT64_T ") stripe %" PRIxGRUB_UINT64_T
 			      " maps to 0x%" PRIxGRUB_UINT64_T "\n",
-			      grub_le_to_cpu64 (key->offset),
+			      chstart,
 			      grub_le_to_cpu64 (chunk->size),
 			      grub_le_to_cpu16 (chunk->nstripes),
 			      grub_le_to_cpu16 (chunk->nsubstripes),
@@ -884,6 +989,9 @@ grub_btrfs_unmount (struct grub_btrfs_data *data)
     grub_device_close (data->devices_attached[i].dev);
   grub_free (data->devices_attached);
   grub_free (data->extent);
+  for (i = 0; i < data->n_chunks; i++)
+    grub_free (data->chunks[i].chunk);
+  grub_free (data->chunks);
   grub_free (data);
 }
 
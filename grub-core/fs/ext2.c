@@ -332,6 +332,12 @@ struct grub_ext2_data
   grub_disk_t disk;
   struct grub_ext2_inode *inode;
   struct grub_fshelp_node diropen;
+  /* Extent tree leaf which last mapped a block of DIROPEN and the file
+     blocks [LEAF_START, LEAF_END) it covers. Only set for a leaf below
+     the inode, those in the inode itself are found without reading.  */
+  struct grub_ext4_extent_header *leaf;
+  grub_uint32_t leaf_start;
+  grub_uint64_t leaf_end;
 };
 
 static grub_dl_t my_mod;
@@ -403,14 +409,20 @@ grub_ext2_blockgroup (struct grub_ext2_data *data, grub_uint64_t group,
 			 sizeof (struct grub_ext2_block_group), blkgrp);
 }
 
+/* Find the leaf of the extent tree rooted at EXT_BLOCK which maps
+   FILEBLOCK. The file blocks the leaf can map are [*START, *END).  */
 static struct grub_ext4_extent_header *
 grub_ext4_find_leaf (struct grub_ext2_data *data,
                      struct grub_ext4_extent_header *ext_block,
-                     grub_uint32_t fileblock)
+                     grub_uint32_t fileblock, grub_uint32_t *start,
+                     grub_uint64_t *end)
 {
   struct grub_ext4_extent_idx *index;
   void *buf = NULL;
 
+  *start = 0;
+  *end = 1ULL << 32;
+
   while (1)
     {
       int i;
@@ -430,9 +442,16 @@ grub_ext4_find_leaf (struct grub_ext2_data *data,
             break;
         }
 
+      if (i < grub_le_to_cpu16 (ext_block->entries)
+	  && grub_le_to_cpu32 (index[i].block) < *end)
+	*end = grub_le_to_cpu32 (index[i].block);
+
       if (--i < 0)
 	goto fail;
 
+      if (grub_le_to_cpu32 (index[i].block) > *start)
+	*start = grub_le_to_cpu32 (index[i].block);
+
       block = grub_le_to_cpu16 (index[i].leaf_hi);
       block = (block << 32) | grub_le_to_cpu32 (index[i].leaf);
       if (!buf)
@@ -451,8 +470,12 @@ grub_ext4_find_leaf (struct grub_ext2_data *data,
   return 0;
 }
 
+/* Map FILEBLOCK to a disk block. For extent mapped files COUNT is set to
+   the number of blocks from FILEBLOCK on which are in the same extent or
+   hole, everything else is mapped one block at a time.  */
 static grub_disk_addr_t
-grub_ext2_read_block (grub_fshelp_node_t node, grub_disk_addr_t fileblock)
+grub_ext2_read_block (grub_fshelp_node_t node, grub_disk_addr_t fileblock,
+		      grub_disk_addr_t *count)
 {
   struct grub_ext2_data *data = node->data;
   struct grub_ext2_inode *inode = &node->inode;
@@ -465,17 +488,31 @@ grub_ext2_read_block (grub_fshelp_node_t node, grub_disk_addr_t fileblock)
 
   if (inode->flags & grub_cpu_to_le32_compile_time (EXT4_EXTENTS_FLAG))
     {
-      struct grub_ext4_extent_header *leaf;
+      struct grub_ext4_extent_header *root, *leaf;
       struct grub_ext4_extent *ext;
       int i;
       grub_disk_addr_t ret;
+      grub_uint32_t leaf_start;
+      grub_uint64_t leaf_end;
 
-      leaf = grub_ext4_find_leaf (data, (struct grub_ext4_extent_header *) inode->blocks.dir_blocks, fileblock);
-      if (! leaf)
-        {
-          grub_error (GRUB_ERR_BAD_FS, "invalid extent");
-          return -1;
-        }
+      root = (struct grub_ext4_extent_header *) inode->blocks.dir_blocks;
+      if (node == &data->diropen && data->leaf
+	  && fileblock >= data->leaf_start && fileblock < data->leaf_end)
+	{
+	  leaf = data->leaf;
+	  leaf_start = data->leaf_start;
+	  leaf_end = data->leaf_end;
+	}
+      else
+	{
+	  leaf = grub_ext4_find_leaf (data, root, fileblock, &leaf_start,
+				      &leaf_end);
+	  if (! leaf)
+	    {
+	      grub_error (GRUB_ERR_BAD_FS, "invalid extent");
+	      return -1;
+	    }
+	}
 
       ext = (struct grub_ext4_extent *) (leaf + 1);
       for (i = 0; i < grub_le_to_cpu16 (leaf->entries); i++)
@@ -486,9 +523,18 @@ grub_ext2_read_block (grub_fshelp_node_t node, grub_disk_addr_t fileblock)
 
       if (--i >= 0)
         {
-          fileblock -= grub_le_to_cpu32 (ext[i].block);
-          if (fileblock >= grub_le_to_cpu16 (ext[i].len))
-	    ret = 0;
+	  grub_disk_addr_t extblock = fileblock - grub_le_to_cpu32 (ext[i].block);
+
+          if (extblock >= grub_le_to_cpu16 (ext[i].len))
+	    {
+	      ret = 0;
+	      /* The hole ends where the next extent starts, or where the
+		 next leaf starts.  */
+	      if (i + 1 < grub_le_to_cpu16 (leaf->entries))
+		*count = grub_le_to_cpu32 (ext[i + 1].block) - fileblock;
+	      else
+		*count = leaf_end - fileblock;
+	    }
           else
             {
               grub_disk_addr_t start;
@@ -496,7 +542,8 @@ grub_ext2_read_block (grub_fshelp_node_t node, grub_disk_addr_t fileblock)
               start = grub_le_to_cpu16 (ext[i].start_hi);
               start = (start << 32) + grub_le_to_cpu32 (ext[i].start);
 
-              ret = fileblock + start;
+              ret = extblock + start;
+	      *count = grub_le_to_cpu16 (ext[i].len) - extblock;
             }
         }
       else
@@ -505,8 +552,19 @@ grub_ext2_read_block (grub_fshelp_node_t node, grub_disk_addr_t fileblock)
 	  ret = -1;
         }
 
-      if (leaf != (struct grub_ext4_extent_header *) inode->blocks.dir_blocks)
-	grub_free (leaf);
+      /* Keep the leaf of the open file for the next blocks.  */
+      if (leaf != root && leaf != data->leaf)
+	{
+	  if (node == &data->diropen)
+	    {
+	      grub_free (data->leaf);
+	      data->leaf = leaf;
+	      data->leaf_start = leaf_start;
+	      data->leaf_end = leaf_end;
+	    }
+	  else
+	    grub_free (leaf);
+	}
 
       return ret;
     }
@@ -567,12 +625,12 @@ grub_ext2_read_file (grub_fshelp_node_t node,
 		     grub_disk_read_hook_t read_hook, void *read_hook_data,
 		     grub_off_t pos, grub_size_t len, char *buf)
 {
-  return grub_fshelp_read_file (node->data->disk, node,
-				read_hook, read_hook_data,
-				pos, len, buf, grub_ext2_read_block,
-				grub_cpu_to_le32 (node->inode.size)
-				| (((grub_off_t) grub_cpu_to_le32 (node->inode.size_high)) << 32),
-				LOG2_EXT2_BLOCK_SIZE (node->data), 0);
+  return grub_fshelp_read_file_extents (node->data->disk, node,
+					read_hook, read_hook_data,
+					pos, len, buf, grub_ext2_read_block,
+					grub_cpu_to_le32 (node->inode.size)
+					| (((grub_off_t) grub_cpu_to_le32 (node->inode.size_high)) << 32),
+					LOG2_EXT2_BLOCK_SIZE (node->data), 0);
 
 }
 
@@ -628,6 +686,8 @@ grub_ext2_mount (grub_disk_t disk)
   if (!data)
     return 0;
 
+  data->leaf = 0;
+
   /* Read the superblock.  */
   grub_disk_read (disk, 1 * 2, 0, sizeof (struct grub_ext2_sblock),
                   &data->sblock);
@@ -694,6 +754,14 @@ grub_ext2_mount (grub_disk_t disk)
   return 0;
 }
 
+static void
+grub_ext2_unmount (struct grub_ext2_data *data)
+{
+  if (data)
+    grub_free (data->leaf);
+  grub_free (data);
+}
+
 static char *
 grub_ext2_read_symlink (grub_fshelp_node_t node)
 {
@@ -860,6 +928,9 @@ grub_ext2_open (struct grub_file *file, const char *name)
 
   grub_memcpy (data->inode, &fdiro->inode, sizeof (struct grub_ext2_inode));
   grub_free (fdiro);
+  /* DIROPEN is the file now, drop what was cached for the root.  */
+  grub_free (data->leaf);
+  data->leaf = 0;
 
   file->size = grub_le_to_cpu32 (data->inode->size);
   file->size |= ((grub_off_t) grub_le_to_cpu32 (data->inode->size_high)) << 32;
@@ -871,7 +942,7 @@ grub_ext2_open (struct grub_file *file, const char *name)
  fail:
   if (fdiro != &data->diropen)
     grub_free (fdiro);
-  grub_free (data);
+  grub_ext2_unmount (data);
 
   grub_dl_unref (my_mod);
 
@@ -881,7 +952,7 @@ grub_ext2_open (struct grub_file *file, const char *name)
 static grub_err_t
 grub_ext2_close (grub_file_t file)
 {
-  grub_free (file->data);
+  grub_ext2_unmount (file->data);
 
   grub_dl_unref (my_mod);
 
@@ -962,7 +1033,7 @@ grub_ext2_dir (grub_device_t device, const char *path, grub_fs_dir_hook_t hook,
  fail:
   if (fdiro != &ctx.data->diropen)
     grub_free (fdiro);
-  grub_free (ctx.data);
+  grub_ext2_unmount (ctx.data);
 
   grub_dl_unref (my_mod);
 
@@ -986,7 +1057,7 @@ grub_ext2_label (grub_device_t device, char **label)
 
   grub_dl_unref (my_mod);
 
-  grub_free (data);
+  grub_ext2_unmount (data);
 
   return grub_errno;
 }
@@ -1017,7 +1088,7 @@ grub_ext2_uuid (grub_device_t device, char **uuid)
 
   grub_dl_unref (my_mod);
 
-  grub_free (data);
+  grub_ext2_unmount (data);
 
   return grub_errno;
 }
@@ -1039,7 +1110,7 @@ grub_ext2_mtime (grub_device_t device, grub_int32_t *tm)
 
   grub_dl_unref (my_mod);
 
-  grub_free (data);
+  grub_ext2_unmount (data);
 
   return grub_errno;
 
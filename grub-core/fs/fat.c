@@ -160,6 +160,15 @@ typedef struct grub_fat_dir_entry grub_fat_dir_node_t;
 
 #endif
 
+/* COUNT clusters starting at CLUSTER on disk, holding the clusters of the
+   file starting with FILE_CLUSTER_NUM.  */
+struct grub_fat_run
+{
+  grub_uint32_t file_cluster_num;
+  grub_uint32_t cluster;
+  grub_uint32_t count;
+};
+
 struct grub_fat_data
 {
   int logical_sector_bits;
@@ -185,8 +194,12 @@ struct grub_fat_data
   grub_uint8_t attr;
   grub_ssize_t file_size;
   grub_uint32_t file_cluster;
-  grub_uint32_t cur_cluster_num;
-  grub_uint32_t cur_cluster;
+
+  /* The cluster chain of the file as far as it was followed so far, as
+     runs of consecutive clusters.  */
+  struct grub_fat_run *runs;
+  unsigned num_runs;
+  unsigned alloc_runs;
 
   grub_uint32_t uuid;
 };
@@ -226,6 +239,9 @@ grub_fat_mount (grub_disk_t disk)
   if (! data)
     goto fail;
 
+  data->runs = 0;
+  data->alloc_runs = 0;
+
   /* Read the BPB.  */
   if (grub_disk_read (disk, 0, 0, sizeof (bpb), &bpb))
     goto fail;
@@ -429,7 +445,7 @@ grub_fat_mount (grub_disk_t disk)
 
   /* Start from the root directory.  */
   data->file_cluster = data->root_cluster;
-  data->cur_cluster_num = ~0U;
+  data->num_runs = 0;
   data->attr = GRUB_FAT_ATTR_DIRECTORY;
 #ifdef MODE_EXFAT
   data->is_contiguous = 0;
@@ -443,6 +459,159 @@ grub_fat_mount (grub_disk_t disk)
   return 0;
 }
 
+static void
+grub_fat_unmount (struct grub_fat_data *data)
+{
+  if (data)
+    grub_free (data->runs);
+  grub_free (data);
+}
+
+/* Read the FAT entry of CLUSTER into *NEXT.  */
+static grub_err_t
+grub_fat_next_cluster (grub_disk_t disk, struct grub_fat_data *data,
+		       grub_uint32_t cluster, grub_uint32_t *next)
+{
+  grub_uint32_t next_cluster = 0;
+  grub_uint32_t fat_offset;
+
+  switch (data->fat_size)
+    {
+    case 32:
+      fat_offset = cluster << 2;
+      break;
+    case 16:
+      fat_offset = cluster << 1;
+      break;
+    default:
+      /* case 12: */
+      fat_offset = cluster + (cluster >> 1);
+      break;
+    }
+
+  /* Read the FAT.  */
+  if (grub_disk_read (disk, data->fat_sector, fat_offset,
+		      (data->fat_size + 7) >> 3,
+		      (char *) &next_cluster))
+    return grub_errno;
+
+  next_cluster = grub_le_to_cpu32 (next_cluster);
+  switch (data->fat_size)
+    {
+    case 16:
+      next_cluster &= 0xFFFF;
+      break;
+    case 12:
+      if (cluster & 1)
+	next_cluster >>= 4;
+
+      next_cluster &= 0x0FFF;
+      break;
+    }
+
+  grub_dprintf ("fat", "fat_size=%d, next_cluster=%u\n",
+		data->fat_size, next_cluster);
+
+  *next = next_cluster;
+  return GRUB_ERR_NONE;
+}
+
+static struct grub_fat_run *
+grub_fat_add_run (struct grub_fat_data *data, grub_uint32_t file_cluster_num,
+		  grub_uint32_t cluster)
+{
+  struct grub_fat_run *run;
+
+  if (data->num_runs == data->alloc_runs)
+    {
+      unsigned alloc = data->alloc_runs ? data->alloc_runs * 2 : 8;
+
+      run = grub_realloc (data->runs, alloc * sizeof (*run));
+      if (!run)
+	return 0;
+      data->runs = run;
+      data->alloc_runs = alloc;
+    }
+
+  run = &data->runs[data->num_runs++];
+  run->file_cluster_num = file_cluster_num;
+  run->cluster = cluster;
+  run->count = 1;
+  return run;
+}
+
+/* Follow the cluster chain of the file until the runs cover file cluster
+   LAST. Returns 1 if the chain ends before it, -1 on error.  */
+static int
+grub_fat_follow_chain (grub_disk_t disk, struct grub_fat_data *data,
+		       grub_uint32_t last)
+{
+  struct grub_fat_run *run;
+
+  if (data->num_runs)
+    run = &data->runs[data->num_runs - 1];
+  else
+    {
+      run = grub_fat_add_run (data, 0, data->file_cluster);
+      if (!run)
+	return -1;
+    }
+
+  while (run->file_cluster_num + run->count - 1 < last)
+    {
+      grub_uint32_t next_cluster = 0;
+
+      if (grub_fat_next_cluster (disk, data, run->cluster + run->count - 1,
+				 &next_cluster))
+	return -1;
+
+      /* Check the end.  */
+      if (next_cluster >= data->cluster_eof_mark)
+	return 1;
+
+      if (next_cluster < 2 || next_cluster >= data->num_clusters)
+	{
+	  grub_error (GRUB_ERR_BAD_FS, "invalid cluster %u",
+		      next_cluster);
+	  return -1;
+	}
+
+      if (next_cluster == run->cluster + run->count)
+	run->count++;
+      else
+	{
+	  run = grub_fat_add_run (data, run->file_cluster_num + run->count,
+				  next_cluster);
+	  if (!run)
+	    return -1;
+	}
+    }
+
+  return 0;
+}
+
+/* Find the run holding file cluster FILE_CLUSTER_NUM.  */
+static struct grub_fat_run *
+grub_fat_find_run (struct grub_fat_data *data, grub_uint32_t file_cluster_num)
+{
+  unsigned lo = 0, hi = data->num_runs;
+
+  while (lo < hi)
+    {
+      unsigned mid = lo + (hi - lo) / 2;
+      struct grub_fat_run *run = &data->runs[mid];
+
+      if (file_cluster_num < run->file_cluster_num)
+	hi = mid;
+      else if (file_cluster_num - run->file_cluster_num >= run->count)
+	lo = mid + 1;
+      else
+	return run;
+    }
+
+  return 0;
+}
+
 static grub_ssize_t
 grub_fat_read_data (grub_disk_t disk, struct grub_fat_data *data,
 		    grub_disk_read_hook_t read_hook, void *read_hook_data,
@@ -450,9 +619,10 @@ grub_fat_read_data (grub_disk_t disk, struct grub_fat_data *data,
 {
   grub_size_t size;
   grub_uint32_t logical_cluster;
+  grub_uint64_t last;
   unsigned logical_cluster_bits;
   grub_ssize_t ret = 0;
-  unsigned long sector;
+  grub_disk_addr_t sector;
 
 #ifndef MODE_EXFAT
   /* This is a special case. FAT12 and FAT16 doesn't have the root directory
@@ -490,85 +660,41 @@ grub_fat_read_data (grub_disk_t disk, struct grub_fat_data *data,
     }
 #endif
 
+  if (!len)
+    return 0;
+
   /* Calculate the logical cluster number and offset.  */
   logical_cluster_bits = (data->cluster_bits
 			  + GRUB_DISK_SECTOR_BITS);
   logical_cluster = offset >> logical_cluster_bits;
+  last = (offset + len - 1) >> logical_cluster_bits;
+  if (last > 0xffffffff)
+    last = 0xffffffff;
   offset &= (1ULL << logical_cluster_bits) - 1;
 
-  if (logical_cluster < data->cur_cluster_num)
-    {
-      data->cur_cluster_num = 0;
-      data->cur_cluster = data->file_cluster;
-    }
+  if (grub_fat_follow_chain (disk, data, last) < 0)
+    return -1;
 
   while (len)
     {
-      while (logical_cluster > data->cur_cluster_num)
-	{
-	  /* Find next cluster.  */
-	  grub_uint32_t next_cluster;
-	  grub_uint32_t fat_offset;
+      struct grub_fat_run *run;
+      grub_uint64_t run_size;
 
-	  switch (data->fat_size)
-	    {
-	    case 32:
-	      fat_offset = data->cur_cluster << 2;
-	      break;
-	    case 16:
-	      fat_offset = data->cur_cluster << 1;
-	      break;
-	    default:
-	      /* case 12: */
-	      fat_offset = data->cur_cluster + (data->cur_cluster >> 1);
-	      break;
-	    }
-
-	  /* Read the FAT.  */
-	  if (grub_disk_read (disk, data->fat_sector, fat_offset,
-			      (data->fat_size + 7) >> 3,
-			      (char *) &next_cluster))
-	    return -1;
-
-	  next_cluster = grub_le_to_cpu32 (next_cluster);
-	  switch (data->fat_size)
-	    {
-	    case 16:
-	      next_cluster &= 0xFFFF;
-	      break;
-	    case 12:
-	      if (data->cur_cluster & 1)
-		next_cluster >>= 4;
-
-	      next_cluster &= 0x0FFF;
-	      break;
-	    }
-
-	  grub_dprintf ("fat", "fat_size=%d, next_cluster=%u\n",
-			data->fat_size, next_cluster);
-
-	  /* Check the end.  */
-	  if (next_cluster >= data->cluster_eof_mark)
-	    return ret;
-
-	  if (next_cluster < 2 || next_cluster >= data->num_clusters)
-	    {
-	      grub_error (GRUB_ERR_BAD_FS, "invalid cluster %u",
-			  next_cluster);
-	      return -1;
-	    }
-
-	  data->cur_cluster = next_cluster;
-	  data->cur_cluster_num++;
-	}
+      run = grub_fat_find_run (data, logical_cluster);
+      if (!run)
+	break;
 
-      /* Read the data here.  */
+      /* Read the data here, up to the end of the run at once.  */
       sector = (data->cluster_sector
-		+ ((data->cur_cluster - 2)
+		+ ((grub_disk_addr_t) (run->cluster - 2
+				       + logical_cluster - run->file_cluster_num)
 		   << data->cluster_bits));
-      size = (1 << logical_cluster_bits) - offset;
-      if (size > len)
-	size = len;
+      run_size = ((grub_uint64_t) (run->file_cluster_num + run->count
+				   - logical_cluster) << logical_cluster_bits)
+	- offset;
+      size = len;
+      if (size > run_size)
+	size = run_size;
 
       disk->read_hook = read_hook;
       disk->read_hook_data = read_hook_data;
@@ -580,7 +706,7 @@ grub_fat_read_data (grub_disk_t disk, struct grub_fat_data *data,
       len -= size;
       buf += size;
       ret += size;
-      logical_cluster++;
+      logical_cluster = run->file_cluster_num + run->count;
       offset = 0;
     }
 
@@ -936,7 +1062,7 @@ grub_fat_find_dir (grub_disk_t disk, struct grub_fat_data *data,
 	  data->file_cluster = ((grub_le_to_cpu16 (ctxt.dir.first_cluster_high) << 16)
 				| grub_le_to_cpu16 (ctxt.dir.first_cluster_low));
 #endif
-	  data->cur_cluster_num = ~0U;
+	  data->num_runs = 0;
 
 	  if (call_hook)
 	    hook (ctxt.filename, &info, hook_data);
@@ -995,7 +1121,7 @@ grub_fat_dir (grub_device_t device, const char *path, grub_fs_dir_hook_t hook,
  fail:
 
   grub_free (dirname);
-  grub_free (data);
+  grub_fat_unmount (data);
 
   grub_dl_unref (my_mod);
 
@@ -1035,7 +1161,7 @@ grub_fat_open (grub_file_t file, const char *name)
 
  fail:
 
-  grub_free (data);
+  grub_fat_unmount (data);
 
   grub_dl_unref (my_mod);
 
@@ -1053,7 +1179,7 @@ grub_fat_read (grub_file_t file, char *buf, grub_size_t len)
 static grub_err_t
 grub_fat_close (grub_file_t file)
 {
-  grub_free (file->data);
+  grub_fat_unmount (file->data);
 
   grub_dl_unref (my_mod);
 
@@ -1099,7 +1225,7 @@ grub_fat_label (grub_device_t device, char **label)
 				* GRUB_MAX_UTF8_PER_UTF16 + 1);
 	  if (!*label)
 	    {
-	      grub_free (data);
+	      grub_fat_unmount (data);
 	      return grub_errno;
 	    }
 	  chc = dir.type_specific.volume_label.character_count;
@@ -1111,7 +1237,7 @@ grub_fat_label (grub_device_t device, char **label)
 	}
     }
 
-  grub_free (data);
+  grub_fat_unmount (data);
   return grub_errno;
 }
 
@@ -1156,7 +1282,7 @@ grub_fat_label (grub_device_t device, char **label)
 
   grub_dl_unref (my_mod);
 
-  grub_free (data);
+  grub_fat_unmount (data);
 
   return grub_errno;
 }
@@ -1186,7 +1312,7 @@ grub_fat_uuid (grub_device_t device, char **uuid)
 
   grub_dl_unref (my_mod);
 
-  grub_free (data);
+  grub_fat_unmount (data);
 
   return grub_errno;
 }
@@ -1209,7 +1335,7 @@ grub_disk_addr_t
 
   *sec_per_lcn = 1ULL << data->cluster_bits;
 
-  grub_free (data);
+  grub_fat_unmount (data);
   return ret;
 }
 #endif
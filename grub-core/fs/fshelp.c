@@ -234,23 +234,55 @@ grub_fshelp_find_file (const char *path, grub_fshelp_node_t rootnode,
   return 0;
 }
 
-/* Read LEN bytes from the file NODE on disk DISK into the buffer BUF,
-   beginning with the block POS.  READ_HOOK should be set before
-   reading a block from the file.  READ_HOOK_DATA is passed through as
-   the DATA argument to READ_HOOK.  GET_BLOCK is used to translate
-   file blocks to disk blocks.  The file is FILESIZE bytes big and the
-   blocks have a size of LOG2BLOCKSIZE (in log2).  */
-grub_ssize_t
-grub_fshelp_read_file (grub_disk_t disk, grub_fshelp_node_t node,
-		       grub_disk_read_hook_t read_hook, void *read_hook_data,
-		       grub_off_t pos, grub_size_t len, char *buf,
-		       grub_disk_addr_t (*get_block) (grub_fshelp_node_t node,
-                                                      grub_disk_addr_t block),
-		       grub_off_t filesize, int log2blocksize,
-		       grub_disk_addr_t blocks_start)
+/* Read the file bytes [START, END) which are stored at disk block BLKNR
+   onwards, or are a hole if BLKNR is 0, to BUF + START - POS.  */
+static grub_err_t
+read_run (grub_disk_t disk, grub_disk_read_hook_t read_hook,
+	  void *read_hook_data, grub_off_t pos, char *buf,
+	  grub_disk_addr_t blknr, grub_off_t start, grub_off_t end,
+	  int log2blocksize, grub_disk_addr_t blocks_start)
 {
-  grub_disk_addr_t i, blockcnt;
-  int blocksize = 1 << (log2blocksize + GRUB_DISK_SECTOR_BITS);
+  grub_off_t offset;
+
+  offset = start & ((1 << (log2blocksize + GRUB_DISK_SECTOR_BITS)) - 1);
+
+  /* If the block number is 0 the run is not stored on disk but is zero
+     filled instead.  */
+  if (!blknr)
+    {
+      grub_memset (buf + (start - pos), 0, end - start);
+      return GRUB_ERR_NONE;
+    }
+
+  disk->read_hook = read_hook;
+  disk->read_hook_data = read_hook_data;
+  grub_disk_read (disk, (blknr << log2blocksize) + blocks_start, offset,
+		  end - start, buf + (start - pos));
+  disk->read_hook = 0;
+
+  return grub_errno;
+}
+
+/* Common part of grub_fshelp_read_file and grub_fshelp_read_file_extents.
+   Exactly one of GET_BLOCK and GET_EXTENT is set. Runs of blocks which
+   follow each other on disk, or are all holes, are read with a single
+   grub_disk_read.  */
+static grub_ssize_t
+read_file_real (grub_disk_t disk, grub_fshelp_node_t node,
+		grub_disk_read_hook_t read_hook, void *read_hook_data,
+		grub_off_t pos, grub_size_t len, char *buf,
+		grub_disk_addr_t (*get_block) (grub_fshelp_node_t node,
+					       grub_disk_addr_t block),
+		grub_disk_addr_t (*get_extent) (grub_fshelp_node_t node,
+						grub_disk_addr_t block,
+						grub_disk_addr_t *count),
+		grub_off_t filesize, int log2blocksize,
+		grub_disk_addr_t blocks_start)
+{
+  grub_disk_addr_t i, blockcnt, count;
+  /* The run not read yet: its first file block, disk block and length.  */
+  grub_disk_addr_t run_block = 0, run_blknr = 0, run_count = 0;
+  int shift = log2blocksize + GRUB_DISK_SECTOR_BITS;
 
   if (pos > filesize)
     {
@@ -263,57 +295,88 @@ grub_fshelp_read_file (grub_disk_t disk, grub_fshelp_node_t node,
   if (pos + len > filesize)
     len = filesize - pos;
 
-  blockcnt = ((len + pos) + blocksize - 1) >> (log2blocksize + GRUB_DISK_SECTOR_BITS);
+  blockcnt = ((len + pos) + (1 << shift) - 1) >> shift;
 
-  for (i = pos >> (log2blocksize + GRUB_DISK_SECTOR_BITS); i < blockcnt; i++)
+  for (i = pos >> shift; i < blockcnt; i += count)
     {
       grub_disk_addr_t blknr;
-      int blockoff = pos & (blocksize - 1);
-      int blockend = blocksize;
 
-      int skipfirst = 0;
-
-      blknr = get_block (node, i);
+      count = 1;
+      if (get_extent)
+	blknr = get_extent (node, i, &count);
+      else
+	blknr = get_block (node, i);
       if (grub_errno)
 	return -1;
 
-      blknr = blknr << log2blocksize;
-
-      /* Last block.  */
-      if (i == blockcnt - 1)
-	{
-	  blockend = (len + pos) & (blocksize - 1);
-
-	  /* The last portion is exactly blocksize.  */
-	  if (! blockend)
-	    blockend = blocksize;
-	}
+      if (count == 0 || count > blockcnt - i)
+	count = blockcnt - i;
 
-      /* First block.  */
-      if (i == (pos >> (log2blocksize + GRUB_DISK_SECTOR_BITS)))
+      if (run_count
+	  && (blknr ? (run_blknr && blknr == run_blknr + run_count)
+	      : !run_blknr))
 	{
-	  skipfirst = blockoff;
-	  blockend -= skipfirst;
+	  run_count += count;
+	  continue;
 	}
 
-      /* If the block number is 0 this block is not stored on disk but
-	 is zero filled instead.  */
-      if (blknr)
-	{
-	  disk->read_hook = read_hook;
-	  disk->read_hook_data = read_hook_data;
-
-	  grub_disk_read (disk, blknr + blocks_start, skipfirst,
-			  blockend, buf);
-	  disk->read_hook = 0;
-	  if (grub_errno)
-	    return -1;
-	}
-      else
-	grub_memset (buf, 0, blockend);
+      if (run_count
+	  && read_run (disk, read_hook, read_hook_data, pos, buf, run_blknr,
+		       grub_max (run_block << shift, pos),
+		       (run_block + run_count) << shift,
+		       log2blocksize, blocks_start))
+	return -1;
 
-      buf += blocksize - skipfirst;
+      run_block = i;
+      run_blknr = blknr;
+      run_count = count;
     }
 
+  if (run_count
+      && read_run (disk, read_hook, read_hook_data, pos, buf, run_blknr,
+		   grub_max (run_block << shift, pos), pos + len,
+		   log2blocksize, blocks_start))
+    return -1;
+
   return len;
 }
+
+/* Read LEN bytes from the file NODE on disk DISK into the buffer BUF,
+   beginning with the block POS.  READ_HOOK should be set before
+   reading a block from the file.  READ_HOOK_DATA is passed through as
+   the DATA argument to READ_HOOK.  GET_BLOCK is used to translate
+   file blocks to disk blocks.  The file is FILESIZE bytes big and the
+   blocks have a size of LOG2BLOCKSIZE (in log2).  */
+grub_ssize_t
+grub_fshelp_read_file (grub_disk_t disk, grub_fshelp_node_t node,
+		       grub_disk_read_hook_t read_hook, void *read_hook_data,
+		       grub_off_t pos, grub_size_t len, char *buf,
+		       grub_disk_addr_t (*get_block) (grub_fshelp_node_t node,
+                                                      grub_disk_addr_t block),
+		       grub_off_t filesize, int log2blocksize,
+		       grub_disk_addr_t blocks_start)
+{
+  return read_file_real (disk, node, read_hook, read_hook_data, pos, len,
+			 buf, get_block, 0, filesize, log2blocksize,
+			 blocks_start);
+}
+
+/* Like grub_fshelp_read_file, but GET_EXTENT also returns in COUNT how
+   many file blocks starting with BLOCK follow each other on disk, or are
+   all holes. COUNT may be 0 if the run goes on up to the end of the
+   file.  */
+grub_ssize_t
+grub_fshelp_read_file_extents (grub_disk_t disk, grub_fshelp_node_t node,
+			       grub_disk_read_hook_t read_hook,
+			       void *read_hook_data,
+			       grub_off_t pos, grub_size_t len, char *buf,
+			       grub_disk_addr_t (*get_extent) (grub_fshelp_node_t node,
+							       grub_disk_addr_t block,
+							       grub_disk_addr_t *count),
+			       grub_off_t filesize, int log2blocksize,
+			       grub_disk_addr_t blocks_start)
+{
+  return read_file_real (disk, node, read_hook, read_hook_data, pos, len,
+			 buf, 0, get_extent, filesize, log2blocksize,
+			 blocks_start);
+}
@@ -345,20 +345,20 @@ retry:
   return 0;
 }
 
+/* Map BLOCK to a cluster and set COUNT to the number of clusters left in
+   its run. Blocks have to be asked for in increasing order.  */
 static grub_disk_addr_t
-grub_ntfs_read_block (grub_fshelp_node_t node, grub_disk_addr_t block)
+grub_ntfs_read_block (grub_fshelp_node_t node, grub_disk_addr_t block,
+		      grub_disk_addr_t *count)
 {
   struct grub_ntfs_rlst *ctx;
 
   ctx = (struct grub_ntfs_rlst *) node;
-  if (block >= ctx->next_vcn)
-    {
-      if (grub_ntfs_read_run_list (ctx))
-	return -1;
-      return ctx->curr_lcn;
-    }
-  else
-    return (ctx->flags & GRUB_NTFS_RF_BLNK) ? 0 : (block -
+  if (block >= ctx->next_vcn && grub_ntfs_read_run_list (ctx))
+    return -1;
+
+  *count = ctx->next_vcn - block;
+  return (ctx->flags & GRUB_NTFS_RF_BLNK) ? 0 : (block -
 					 ctx->curr_vcn + ctx->curr_lcn);
 }
 
@@ -434,11 +434,11 @@ read_data (struct grub_ntfs_attr *at, grub_uint8_t *pa, grub_uint8_t *dest,
       return 0;
     }
 
-  grub_fshelp_read_file (ctx->comp.disk, (grub_fshelp_node_t) ctx,
-			 read_hook, read_hook_data, ofs, len,
-			 (char *) dest,
-			 grub_ntfs_read_block, ofs + len,
-			 ctx->comp.log_spc, 0);
+  grub_fshelp_read_file_extents (ctx->comp.disk, (grub_fshelp_node_t) ctx,
+				 read_hook, read_hook_data, ofs, len,
+				 (char *) dest,
+				 grub_ntfs_read_block, ofs + len,
+				 ctx->comp.log_spc, 0);
   return grub_errno;
 }
 
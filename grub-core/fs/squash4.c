@@ -22,10 +22,12 @@
 #include <grub/mm.h>
 #include <grub/misc.h>
 #include <grub/disk.h>
+#include <grub/partition.h>
 #include <grub/dl.h>
 #include <grub/types.h>
 #include <grub/fshelp.h>
 #include <grub/deflate.h>
+#include <grub/time.h>
 #include <minilzo.h>
 
 #include "xz.h"
@@ -216,6 +218,144 @@ struct grub_fshelp_node
   } stack[1];
 };
 
+/* Decompressed metadata chunks, fragment blocks and partially read data
+   blocks. It's shared by all mounts as every file open mounts again and
+   opening a bunch of small files goes through the same metadata and
+   fragment blocks over and over. The least recently used block is
+   dropped once there are SQUASH_CACHE_SLOTS blocks or
+   SQUASH_CACHE_MAX_SIZE bytes. Like the disk cache, everything is
+   dropped when nothing was mounted for SQUASH_CACHE_TIMEOUT seconds, as
+   the media may have been changed in the meantime.  */
+#define SQUASH_CACHE_SLOTS 32
+#define SQUASH_CACHE_MAX_SIZE (4 << 20)
+#define SQUASH_CACHE_TIMEOUT 2
+
+struct grub_squash_cache_block
+{
+  unsigned long dev_id;
+  unsigned long disk_id;
+  /* Byte offset of the compressed block from the start of the disk.  */
+  grub_uint64_t start;
+  char *data;
+  grub_size_t size;
+  grub_size_t alloc_size;
+  unsigned long last_use;
+};
+
+static struct grub_squash_cache_block block_cache[SQUASH_CACHE_SLOTS];
+static grub_size_t block_cache_size;
+static unsigned long block_cache_clock;
+static unsigned long block_cache_hits, block_cache_misses;
+/* The last time a mount went away.  */
+static grub_uint64_t block_cache_last_time;
+
+static void
+drop_cached_block (struct grub_squash_cache_block *cb)
+{
+  grub_free (cb->data);
+  block_cache_size -= cb->alloc_size;
+  cb->data = 0;
+  cb->alloc_size = 0;
+}
+
+static void
+drop_all_cached_blocks (void)
+{
+  unsigned i;
+
+  for (i = 0; i < SQUASH_CACHE_SLOTS; i++)
+    if (block_cache[i].data)
+      drop_cached_block (&block_cache[i]);
+}
+
+/* Return the decompressed contents of the compressed block of CSIZE bytes
+   at START, which decompresses to at most USIZE bytes, and set *SIZE to
+   its actual length. The result is only valid until the next call.  */
+static const char *
+get_block (struct grub_squash_data *data, grub_uint64_t start,
+	   grub_size_t csize, grub_size_t usize, grub_size_t *size)
+{
+  struct grub_squash_cache_block *cb, *victim = 0;
+  unsigned long dev_id = data->disk->dev->id;
+  unsigned long disk_id = data->disk->id;
+  grub_uint64_t key;
+  grub_ssize_t ret;
+  char *tmp, *out;
+  grub_err_t err;
+
+  key = start + (grub_partition_get_start (data->disk->partition)
+		 << GRUB_DISK_SECTOR_BITS);
+
+  for (cb = block_cache; cb < block_cache + SQUASH_CACHE_SLOTS; cb++)
+    if (cb->data && cb->start == key && cb->dev_id == dev_id
+	&& cb->disk_id == disk_id)
+      {
+	block_cache_hits++;
+	cb->last_use = ++block_cache_clock;
+	*size = cb->size;
+	return cb->data;
+      }
+
+  block_cache_misses++;
+
+  tmp = grub_malloc (csize);
+  if (!tmp)
+    return NULL;
+  err = grub_disk_read (data->disk, start >> GRUB_DISK_SECTOR_BITS,
+			start & (GRUB_DISK_SECTOR_SIZE - 1), csize, tmp);
+  if (err)
+    {
+      grub_free (tmp);
+      return NULL;
+    }
+
+  out = grub_malloc (usize);
+  if (!out)
+    {
+      grub_free (tmp);
+      return NULL;
+    }
+  ret = data->decompress (tmp, csize, 0, out, usize, data);
+  grub_free (tmp);
+  if (ret < 0)
+    {
+      grub_free (out);
+      return NULL;
+    }
+
+  /* Make room, then take a free slot or the least recently used one.  */
+  while (block_cache_size + usize > SQUASH_CACHE_MAX_SIZE)
+    {
+      struct grub_squash_cache_block *lru = 0;
+
+      for (cb = block_cache; cb < block_cache + SQUASH_CACHE_SLOTS; cb++)
+	if (cb->data && (!lru || cb->last_use < lru->last_use))
+	  lru = cb;
+      if (!lru)
+	break;
+      drop_cached_block (lru);
+    }
+
+  for (cb = block_cache; cb < block_cache + SQUASH_CACHE_SLOTS; cb++)
+    if (!victim || (victim->data
+		    && (!cb->data || cb->last_use < victim->last_use)))
+      victim = cb;
+  if (victim->data)
+    drop_cached_block (victim);
+
+  victim->dev_id = dev_id;
+  victim->disk_id = disk_id;
+  victim->start = key;
+  victim->data = out;
+  victim->size = ret;
+  victim->alloc_size = usize;
+  victim->last_use = ++block_cache_clock;
+  block_cache_size += usize;
+
+  *size = ret;
+  return out;
+}
+
 static grub_err_t
 read_chunk (struct grub_squash_data *data, void *buf, grub_size_t len,
 	    grub_uint64_t chunk_start, grub_off_t offset)
@@ -254,29 +394,17 @@ read_chunk (struct grub_squash_data *data, void *buf, grub_size_t len,
 	}
       else
 	{
-	  char *tmp;
+	  const char *chunk;
 	  grub_size_t bsize = grub_le_to_cpu16 (d) & ~SQUASH_CHUNK_FLAGS; 
-	  grub_disk_addr_t a = chunk_start + 2;
-	  tmp = grub_malloc (bsize);
-	  if (!tmp)
-	    return grub_errno;
-	  /* FIXME: buffer uncompressed data.  */
-	  err = grub_disk_read (data->disk, (a >> GRUB_DISK_SECTOR_BITS),
-				a & (GRUB_DISK_SECTOR_SIZE - 1),
-				bsize, tmp);
-	  if (err)
-	    {
-	      grub_free (tmp);
-	      return err;
-	    }
+	  grub_size_t usize;
 
-	  if (data->decompress (tmp, bsize, offset,
-				buf, csize, data) < 0)
-	    {
-	      grub_free (tmp);
-	      return grub_errno;
-	    }
-	  grub_free (tmp);
+	  chunk = get_block (data, chunk_start + 2, bsize, SQUASH_CHUNK_SIZE,
+			     &usize);
+	  if (!chunk)
+	    return grub_errno;
+	  if (offset + csize > usize)
+	    return grub_error (GRUB_ERR_BAD_FS, "incorrect compressed chunk");
+	  grub_memcpy (buf, chunk + offset, csize);
 	}
       len -= csize;
       offset += csize;
@@ -385,6 +513,10 @@ squash_mount (grub_disk_t disk)
   struct grub_squash_data *data;
   grub_uint64_t frag;
 
+  if (grub_get_time_ms () > block_cache_last_time
+      + SQUASH_CACHE_TIMEOUT * 1000)
+    drop_all_cached_blocks ();
+
   err = grub_disk_read (disk, 0, 0, sizeof (sb), &sb);
   if (grub_errno == GRUB_ERR_OUT_OF_RANGE)
     grub_error (GRUB_ERR_BAD_FS, "not a squash4");
@@ -628,6 +760,9 @@ make_root_node (struct grub_squash_data *data, struct grub_fshelp_node *root)
 static void
 squash_unmount (struct grub_squash_data *data)
 {
+  grub_dprintf ("squash4", "block cache: %lu hits, %lu misses\n",
+		block_cache_hits, block_cache_misses);
+  block_cache_last_time = grub_get_time_ms ();
   if (data->xzdec)
     xz_dec_end (data->xzdec);
   grub_free (data->xzbuf);
@@ -824,7 +959,29 @@ direct_read (struct grub_squash_data *data,
       if (curread > len)
 	curread = len;
       if (!(ino->block_sizes[i]
-	    & grub_cpu_to_le32_compile_time (SQUASH_BLOCK_UNCOMPRESSED)))
+	    & grub_cpu_to_le32_compile_time (SQUASH_BLOCK_UNCOMPRESSED))
+	  && curread != data->blksz)
+	{
+	  /* Partial reads, likely to be followed by reads of the rest of
+	     the block, go through the cache.  */
+	  const char *block;
+	  grub_size_t csize, usize;
+
+	  csize = grub_le_to_cpu32 (ino->block_sizes[i]) & ~SQUASH_BLOCK_FLAGS;
+	  block = get_block (data, ino->cumulated_block_sizes[i] + a, csize,
+			     data->blksz, &usize);
+	  if (!block)
+	    return -1;
+	  if (boff + curread > usize)
+	    {
+	      grub_error (GRUB_ERR_BAD_FS, "incorrect compressed chunk");
+	      return -1;
+	    }
+	  grub_memcpy (buf, block + boff, curread);
+	  err = GRUB_ERR_NONE;
+	}
+      else if (!(ino->block_sizes[i]
+		 & grub_cpu_to_le32_compile_time (SQUASH_BLOCK_UNCOMPRESSED)))
 	{
 	  char *block;
 	  grub_size_t csize;
@@ -909,32 +1066,21 @@ grub_squash_read_data (struct grub_squash_data *data,
   else
     b = grub_le_to_cpu32 (ino->ino.file.offset) + off;
   
-  /* FIXME: cache uncompressed chunks.  */
   if (compressed)
     {
-      char *block;
-      block = grub_malloc (grub_le_to_cpu32 (frag.size));
+      const char *block;
+      grub_size_t usize;
+
+      block = get_block (data, a, grub_le_to_cpu32 (frag.size), data->blksz,
+			 &usize);
       if (!block)
 	return -1;
-      err = grub_disk_read (data->disk,
-			    a >> GRUB_DISK_SECTOR_BITS,
-			    a & (GRUB_DISK_SECTOR_SIZE - 1),
-			    grub_le_to_cpu32 (frag.size), block);
-      if (err)
-	{
-	  grub_free (block);
-	  return -1;
-	}
-      if (data->decompress (block, grub_le_to_cpu32 (frag.size),
-			    b, buf, len, data)
-	  != (grub_ssize_t) len)
+      if (b > usize || len > usize - b)
 	{
-	  grub_free (block);
-	  if (!grub_errno)
-	    grub_error (GRUB_ERR_BAD_FS, "incorrect compressed chunk");
+	  grub_error (GRUB_ERR_BAD_FS, "incorrect compressed chunk");
 	  return -1;
 	}
-      grub_free (block);
+      grub_memcpy (buf, block + b, len);
     }
   else
     {
@@ -998,5 +1144,6 @@ GRUB_MOD_INIT(squash4)
 GRUB_MOD_FINI(squash4)
 {
   grub_fs_unregister (&grub_squash_fs);
+  drop_all_cached_blocks ();
 }
 
@@ -275,8 +275,11 @@ grub_xfs_read_inode (struct grub_xfs_data *data, grub_uint64_t ino,
 }
 
 
+/* Map FILEBLOCK to a disk block and set COUNT to the number of blocks
+   from FILEBLOCK on which are in the same extent or hole.  */
 static grub_disk_addr_t
-grub_xfs_read_block (grub_fshelp_node_t node, grub_disk_addr_t fileblock)
+grub_xfs_read_block (grub_fshelp_node_t node, grub_disk_addr_t fileblock,
+		     grub_disk_addr_t *count)
 {
   struct grub_xfs_btree_node *leaf = 0;
   int ex, nrec;
@@ -361,10 +364,14 @@ grub_xfs_read_block (grub_fshelp_node_t node, grub_disk_addr_t fileblock)
 
       /* Sparse block.  */
       if (fileblock < offset)
-        break;
+        {
+          *count = offset - fileblock;
+          break;
+        }
       else if (fileblock < offset + size)
         {
           ret = (fileblock - offset + start);
+          *count = offset + size - fileblock;
           break;
         }
     }
@@ -382,12 +389,12 @@ grub_xfs_read_file (grub_fshelp_node_t node,
 		     grub_disk_read_hook_t read_hook, void *read_hook_data,
 		     grub_off_t pos, grub_size_t len, char *buf)
 {
-  return grub_fshelp_read_file (node->data->disk, node,
-				read_hook, read_hook_data,
-				pos, len, buf, grub_xfs_read_block,
-				grub_be_to_cpu64 (node->inode.size),
-				node->data->sblock.log2_bsize
-				- GRUB_DISK_SECTOR_BITS, 0);
+  return grub_fshelp_read_file_extents (node->data->disk, node,
+					read_hook, read_hook_data,
+					pos, len, buf, grub_xfs_read_block,
+					grub_be_to_cpu64 (node->inode.size),
+					node->data->sblock.log2_bsize
+					- GRUB_DISK_SECTOR_BITS, 0);
 }
 
 
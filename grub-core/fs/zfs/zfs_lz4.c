@@ -36,6 +36,7 @@
 #include <grub/mm.h>
 #include <grub/misc.h>
 #include <grub/types.h>
+#include <grub/lib/lz4.h>
 
 static int LZ4_uncompress_unknownOutputSize(const char *source, char *dest,
 					    int isize, int maxOutputSize);
@@ -154,6 +155,14 @@ lz4_decompress(void *s_start, void *d_start, size_t s_len, size_t d_len)
 	    d_len) < 0)?grub_error(GRUB_ERR_BAD_FS,"lz4 decompression failed."):0;
 }
 
+int
+lz4_decompress_block(const void *s_start, void *d_start, size_t s_len,
+    size_t d_len)
+{
+	return (LZ4_uncompress_unknownOutputSize(s_start, d_start, s_len,
+	    d_len));
+}
+
 static int
 LZ4_uncompress_unknownOutputSize(const char *source,
     char *dest, int isize, int maxOutputSize)
@@ -0,0 +1,432 @@
+/* lz4io.c - decompression support for lz4 legacy frames */
+/*
+ *  GRUB  --  GRand Unified Bootloader
+ *  Copyright (C) 2024  Free Software Foundation, Inc.
+ *
+ *  GRUB is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  GRUB is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with GRUB.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/* This is the format "lz4 -l" writes and Linux uses for its LZ4
+   compressed kernels and initramfs images: a 4 byte magic followed by
+   blocks of [le32 compressed size][raw lz4 block]. Every block but the
+   last one decodes to exactly LZ4IO_BLOCK_SIZE bytes. The end is either
+   the end of the file or a size field which doesn't fit in the rest of
+   the file, like the uncompressed size kbuild appends.  */
+
+#include <grub/err.h>
+#include <grub/mm.h>
+#include <grub/misc.h>
+#include <grub/file.h>
+#include <grub/fs.h>
+#include <grub/dl.h>
+#include <grub/i18n.h>
+#include <grub/lib/lz4.h>
+
+GRUB_MOD_LICENSE ("GPLv3+");
+
+#define LZ4IO_MAGIC 0x184C2102
+#define LZ4IO_BLOCK_SIZE (8 << 20)
+/* Worst case expansion of incompressible input, see LZ4_compressBound.  */
+#define LZ4IO_MAX_CSIZE (LZ4IO_BLOCK_SIZE + LZ4IO_BLOCK_SIZE / 255 + 16)
+
+struct grub_lz4io
+{
+  grub_file_t file;
+  /* Current block: where its compressed data starts in FILE, how long it
+     is and where its data starts in the uncompressed stream. CSIZE of 0
+     means end of stream.  */
+  grub_off_t block_off;
+  grub_uint32_t csize;
+  grub_off_t uoff;
+  /* Compressed current block, big enough for the largest one in FILE.  */
+  grub_uint8_t *cdata;
+  /* Decoded current block, only allocated for reads which don't cover a
+     whole block. Everything else is decoded straight into the caller's
+     buffer.  */
+  char *udata;
+  int udata_valid;
+};
+
+typedef struct grub_lz4io *grub_lz4io_t;
+static struct grub_fs grub_lz4io_fs;
+
+/* Read the size field at OFF and make the block behind it the current one.
+   Magic numbers in between, as left by concatenating archives, are
+   skipped.  */
+static int
+read_block_header (grub_lz4io_t lz4io, grub_off_t off)
+{
+  grub_uint32_t csize;
+
+  lz4io->udata_valid = 0;
+  lz4io->csize = 0;
+
+  do
+    {
+      if (grub_file_seek (lz4io->file, off) == (grub_off_t) -1
+	  || grub_file_read (lz4io->file, &csize, sizeof (csize))
+	  != sizeof (csize))
+	{
+	  /* Plain end of file.  */
+	  grub_errno = GRUB_ERR_NONE;
+	  lz4io->block_off = off;
+	  return 0;
+	}
+      off += sizeof (csize);
+      csize = grub_le_to_cpu32 (csize);
+    }
+  while (csize == LZ4IO_MAGIC);
+
+  lz4io->block_off = off;
+
+  if (csize == 0 || csize > lz4io->file->size - off)
+    return 0;
+
+  if (csize > LZ4IO_MAX_CSIZE)
+    return -1;
+
+  lz4io->csize = csize;
+  return 0;
+}
+
+static int
+read_block (grub_lz4io_t lz4io)
+{
+  if (grub_file_seek (lz4io->file, lz4io->block_off) == (grub_off_t) -1
+      || grub_file_read (lz4io->file, lz4io->cdata, lz4io->csize)
+      != (grub_ssize_t) lz4io->csize)
+    return -1;
+  return 0;
+}
+
+/* Decode the current block into DEST and return its length. The decoder
+   uses all of the USIZE bytes at DEST as scratch space, so this must be
+   the real length of the block and not just an upper bound.  */
+static grub_ssize_t
+decode_block (grub_lz4io_t lz4io, char *dest, grub_size_t usize)
+{
+  int ret;
+
+  if (read_block (lz4io) < 0)
+    return -1;
+
+  ret = lz4_decompress_block (lz4io->cdata, dest, lz4io->csize, usize);
+  if (ret <= 0)
+    return -1;
+
+  return ret;
+}
+
+/* Work out how long the current block is from its sequence headers,
+   without anywhere to decode it to.  */
+static grub_ssize_t
+block_length (grub_lz4io_t lz4io)
+{
+  const grub_uint8_t *src = lz4io->cdata;
+  const grub_uint8_t *end = src + lz4io->csize;
+  grub_size_t len = 0;
+
+  while (src < end)
+    {
+      unsigned token = *src++;
+      grub_size_t n = token >> 4;
+
+      if (n == 15)
+	do
+	  {
+	    if (src == end)
+	      return -1;
+	    n += *src;
+	  }
+	while (*src++ == 255);
+      if (n > (grub_size_t) (end - src))
+	return -1;
+      src += n;
+      len += n;
+
+      /* The last sequence has only literals.  */
+      if (src == end)
+	break;
+
+      /* Match offset and length.  */
+      if (end - src < 2)
+	return -1;
+      src += 2;
+      n = (token & 15) + 4;
+      if (n == 19)
+	do
+	  {
+	    if (src == end)
+	      return -1;
+	    n += *src;
+	  }
+	while (*src++ == 255);
+      len += n;
+
+      if (len > LZ4IO_BLOCK_SIZE)
+	return -1;
+    }
+
+  if (len > LZ4IO_BLOCK_SIZE)
+    return -1;
+  return len;
+}
+
+/* Uncompressed size of the current block. Only the last block may be
+   short and its length is known from the file size.  */
+static grub_size_t
+block_usize (grub_file_t file)
+{
+  grub_lz4io_t lz4io = file->data;
+
+  if (file->size - lz4io->uoff < LZ4IO_BLOCK_SIZE)
+    return file->size - lz4io->uoff;
+  return LZ4IO_BLOCK_SIZE;
+}
+
+static int
+rewind_stream (grub_lz4io_t lz4io)
+{
+  lz4io->uoff = 0;
+  return read_block_header (lz4io, sizeof (grub_uint32_t));
+}
+
+static int
+next_block (grub_file_t file)
+{
+  grub_lz4io_t lz4io = file->data;
+
+  lz4io->uoff += block_usize (file);
+  return read_block_header (lz4io, lz4io->block_off + lz4io->csize);
+}
+
+/* Walk the size fields and measure the last block, it's the only one
+   whose uncompressed size isn't fixed.  */
+static int
+calculate_uncompressed_size (grub_file_t file)
+{
+  grub_lz4io_t lz4io = file->data;
+  grub_off_t last_off = 0;
+  grub_uint32_t last_csize = 0;
+  grub_uint32_t max_csize = 0;
+  grub_off_t usize = 0;
+  grub_ssize_t len;
+
+  if (rewind_stream (lz4io) < 0)
+    return -1;
+
+  while (lz4io->csize)
+    {
+      last_off = lz4io->block_off;
+      last_csize = lz4io->csize;
+      if (max_csize < last_csize)
+	max_csize = last_csize;
+      usize += LZ4IO_BLOCK_SIZE;
+
+      if (read_block_header (lz4io, lz4io->block_off + lz4io->csize) < 0)
+	return -1;
+    }
+
+  if (!last_csize)
+    return -1;
+
+  /* The blocks are rarely anywhere near the worst case size.  */
+  lz4io->cdata = grub_malloc (max_csize);
+  if (!lz4io->cdata)
+    return -1;
+
+  lz4io->block_off = last_off;
+  lz4io->csize = last_csize;
+  if (read_block (lz4io) < 0)
+    return -1;
+  len = block_length (lz4io);
+  if (len <= 0)
+    return -1;
+
+  file->size = usize - LZ4IO_BLOCK_SIZE + len;
+
+  return 0;
+}
+
+static int
+test_header (grub_file_t file)
+{
+  grub_lz4io_t lz4io = file->data;
+  grub_uint32_t magic;
+
+  if (grub_file_read (lz4io->file, &magic, sizeof (magic)) != sizeof (magic))
+    return 0;
+
+  if (grub_le_to_cpu32 (magic) != LZ4IO_MAGIC)
+    return 0;
+
+  if (calculate_uncompressed_size (file) < 0)
+    return 0;
+
+  /* Get back to the first block.  */
+  if (rewind_stream (lz4io) < 0)
+    return 0;
+
+  return 1;
+}
+
+static grub_file_t
+grub_lz4io_open (grub_file_t io,
+		 const char *name __attribute__ ((unused)))
+{
+  grub_file_t file;
+  grub_lz4io_t lz4io;
+
+  file = (grub_file_t) grub_zalloc (sizeof (*file));
+  if (!file)
+    return 0;
+
+  lz4io = grub_zalloc (sizeof (*lz4io));
+  if (!lz4io)
+    {
+      grub_free (file);
+      return 0;
+    }
+
+  lz4io->file = io;
+
+  file->device = io->device;
+  file->data = lz4io;
+  file->fs = &grub_lz4io_fs;
+  file->size = GRUB_FILE_SIZE_UNKNOWN;
+  file->not_easily_seekable = 1;
+
+  if (grub_file_tell (lz4io->file) != 0)
+    grub_file_seek (lz4io->file, 0);
+
+  if (!test_header (file))
+    {
+      grub_errno = GRUB_ERR_NONE;
+      grub_file_seek (io, 0);
+      grub_free (lz4io->cdata);
+      grub_free (lz4io->udata);
+      grub_free (lz4io);
+      grub_free (file);
+
+      return io;
+    }
+
+  return file;
+}
+
+static grub_ssize_t
+grub_lz4io_read (grub_file_t file, char *buf, grub_size_t len)
+{
+  grub_lz4io_t lz4io = file->data;
+  grub_off_t pos = grub_file_tell (file);
+  grub_ssize_t ret = 0;
+
+  /* Backward seek before the current block.  */
+  if (lz4io->uoff > pos && rewind_stream (lz4io) < 0)
+    goto CORRUPTED;
+
+  /* Forward to the block with the requested data, the sizes are known so
+     nothing needs to be decoded for that.  */
+  while (lz4io->csize && lz4io->uoff + block_usize (file) <= pos)
+    if (next_block (file) < 0)
+      goto CORRUPTED;
+
+  while (len != 0 && lz4io->csize)
+    {
+      grub_size_t usize = block_usize (file);
+      grub_size_t off = pos - lz4io->uoff;
+      grub_size_t to_copy;
+
+      to_copy = usize - off;
+      if (to_copy > len)
+	to_copy = len;
+
+      if (off == 0 && to_copy == usize && !lz4io->udata_valid)
+	{
+	  /* Whole block requested, decode it in place.  */
+	  if (decode_block (lz4io, buf, usize) != (grub_ssize_t) usize)
+	    goto CORRUPTED;
+	}
+      else
+	{
+	  if (!lz4io->udata)
+	    {
+	      /* No block is longer than the whole file.  */
+	      lz4io->udata = grub_malloc (file->size < LZ4IO_BLOCK_SIZE
+					  ? file->size : LZ4IO_BLOCK_SIZE);
+	      if (!lz4io->udata)
+		return -1;
+	    }
+	  if (!lz4io->udata_valid)
+	    {
+	      if (decode_block (lz4io, lz4io->udata, usize)
+		  != (grub_ssize_t) usize)
+		goto CORRUPTED;
+	      lz4io->udata_valid = 1;
+	    }
+	  grub_memcpy (buf, lz4io->udata + off, to_copy);
+	}
+
+      len -= to_copy;
+      buf += to_copy;
+      pos += to_copy;
+      ret += to_copy;
+
+      if (off + to_copy == usize && next_block (file) < 0)
+	goto CORRUPTED;
+    }
+
+  return ret;
+
+CORRUPTED:
+  grub_error (GRUB_ERR_BAD_COMPRESSED_DATA, N_("lz4 file corrupted"));
+  return -1;
+}
+
+/* Release everything, including the underlying file object.  */
+static grub_err_t
+grub_lz4io_close (grub_file_t file)
+{
+  grub_lz4io_t lz4io = file->data;
+
+  grub_file_close (lz4io->file);
+  grub_free (lz4io->cdata);
+  grub_free (lz4io->udata);
+  grub_free (lz4io);
+
+  /* Device must not be closed twice.  */
+  file->device = 0;
+  file->name = 0;
+  return grub_errno;
+}
+
+static struct grub_fs grub_lz4io_fs = {
+  .name = "lz4io",
+  .dir = 0,
+  .open = 0,
+  .read = grub_lz4io_read,
+  .close = grub_lz4io_close,
+  .label = 0,
+  .next = 0
+};
+
+GRUB_MOD_INIT (lz4io)
+{
+  grub_file_filter_register (GRUB_FILE_FILTER_LZ4IO, grub_lz4io_open);
+}
+
+GRUB_MOD_FINI (lz4io)
+{
+  grub_file_filter_unregister (GRUB_FILE_FILTER_LZ4IO);
+}
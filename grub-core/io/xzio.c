@@ -33,6 +33,13 @@ GRUB_MOD_LICENSE ("GPLv3+");
 #define VLI_MAX_DIGITS 9
 #define XZ_STREAM_FOOTER_SIZE 12
 
+/* Where a block starts in the uncompressed data and in the file.  */
+struct grub_xzio_block
+{
+  grub_uint64_t uoff;
+  grub_uint64_t coff;
+};
+
 struct grub_xzio
 {
   grub_file_t file;
@@ -41,6 +48,13 @@ struct grub_xzio
   grub_uint8_t inbuf[XZBUFSIZ];
   grub_uint8_t outbuf[XZBUFSIZ];
   grub_off_t saved_offset;
+  /* Block index from the stream index, if the file is a single stream it
+     describes. Decoding can restart at any of these blocks. The input is
+     never fed past INDEX_OFF so that a decoder which skipped blocks
+     doesn't see the index and complain about it.  */
+  struct grub_xzio_block *blocks;
+  grub_size_t num_blocks;
+  grub_off_t index_off;
 };
 
 typedef struct grub_xzio *grub_xzio_t;
@@ -121,8 +135,12 @@ test_footer (grub_file_t file)
   grub_uint32_t backsize;
   grub_uint8_t imarker;
   grub_uint64_t uncompressed_size_total = 0;
+  grub_uint64_t compressed_size_total = 0;
   grub_uint64_t uncompressed_size;
+  grub_uint64_t unpadded_size;
   grub_uint64_t records;
+  grub_off_t index_off;
+  grub_size_t i;
 
   grub_file_seek (xzio->file, xzio->file->size - FOOTER_MAGIC_SIZE);
   if (grub_file_read (xzio->file, footer, FOOTER_MAGIC_SIZE)
@@ -139,8 +157,8 @@ test_footer (grub_file_t file)
   backsize = (grub_le_to_cpu32 (backsize) + 1) * 4;
 
   /* Set file to the beginning of stream index.  */
-  grub_file_seek (xzio->file,
-		  xzio->file->size - XZ_STREAM_FOOTER_SIZE - backsize);
+  index_off = xzio->file->size - XZ_STREAM_FOOTER_SIZE - backsize;
+  grub_file_seek (xzio->file, index_off);
 
   /* Test index marker.  */
   if (grub_file_read (xzio->file, &imarker, sizeof (imarker))
@@ -150,24 +168,108 @@ test_footer (grub_file_t file)
   if (read_vli (xzio->file, &records) <= 0)
     goto ERROR;
 
-  for (; records != 0; records--)
+  /* Every record takes at least 2 bytes.  */
+  if (records > backsize / 2)
+    goto ERROR;
+
+  /* Without the block table seeks just decode from the start.  */
+  if (records && records <= GRUB_SIZE_MAX / sizeof (xzio->blocks[0]))
     {
-      if (read_vli (xzio->file, &uncompressed_size) <= 0)	/* Ignore unpadded.  */
+      xzio->blocks = grub_malloc (records * sizeof (xzio->blocks[0]));
+      if (!xzio->blocks)
+	goto ERROR;
+    }
+
+  for (i = 0; i < records; i++)
+    {
+      if (read_vli (xzio->file, &unpadded_size) <= 0)
 	goto ERROR;
       if (read_vli (xzio->file, &uncompressed_size) <= 0)	/* Uncompressed.  */
 	goto ERROR;
 
+      if (xzio->blocks)
+	{
+	  xzio->blocks[i].uoff = uncompressed_size_total;
+	  xzio->blocks[i].coff = STREAM_HEADER_SIZE + compressed_size_total;
+	}
       uncompressed_size_total += uncompressed_size;
+      compressed_size_total += ALIGN_UP (unpadded_size, 4);
     }
 
   file->size = uncompressed_size_total;
   grub_file_seek (xzio->file, STREAM_HEADER_SIZE);
+
+  /* The block offsets are only right if this index describes the whole
+     file, i.e. there is a single stream.  */
+  if (xzio->blocks && STREAM_HEADER_SIZE + compressed_size_total == index_off)
+    {
+      xzio->num_blocks = records;
+      xzio->index_off = index_off;
+    }
+  else
+    {
+      grub_free (xzio->blocks);
+      xzio->blocks = 0;
+    }
+
   return 1;
 
 ERROR:
+  grub_free (xzio->blocks);
+  xzio->blocks = 0;
   return 0;
 }
 
+/* Make decoding restart at the block holding OFFSET.  */
+static int
+seek_block (grub_xzio_t xzio, grub_off_t offset)
+{
+  grub_size_t lo = 0, hi = xzio->num_blocks;
+
+  while (hi - lo > 1)
+    {
+      grub_size_t mid = lo + (hi - lo) / 2;
+
+      if (xzio->blocks[mid].uoff <= offset)
+	lo = mid;
+      else
+	hi = mid;
+    }
+
+  /* Feed the stream header first, it says which check the blocks have.  */
+  xz_dec_reset (xzio->dec);
+  xzio->buf.out_pos = 0;
+  xzio->buf.in_pos = 0;
+  grub_file_seek (xzio->file, 0);
+  xzio->buf.in_size = grub_file_read (xzio->file, xzio->inbuf,
+				      STREAM_HEADER_SIZE);
+  if (xzio->buf.in_size != STREAM_HEADER_SIZE)
+    return 0;
+
+  grub_file_seek (xzio->file, xzio->blocks[lo].coff);
+  xzio->saved_offset = xzio->blocks[lo].uoff;
+  return 1;
+}
+
+/* Whether OFFSET is in a later block than the one being decoded.  */
+static int
+in_later_block (grub_xzio_t xzio, grub_off_t offset)
+{
+  grub_size_t lo = 0, hi = xzio->num_blocks;
+
+  while (lo < hi)
+    {
+      grub_size_t mid = lo + (hi - lo) / 2;
+
+      if (xzio->blocks[mid].uoff <= xzio->saved_offset)
+	lo = mid + 1;
+      else
+	hi = mid;
+    }
+
+  return lo < xzio->num_blocks && xzio->blocks[lo].uoff <= offset;
+}
+
 static grub_file_t
 grub_xzio_open (grub_file_t io,
 		const char *name __attribute__ ((unused)))
@@ -217,6 +319,7 @@ grub_xzio_open (grub_file_t io,
       grub_errno = GRUB_ERR_NONE;
       grub_file_seek (io, 0);
       xz_dec_end (xzio->dec);
+      grub_free (xzio->blocks);
       grub_free (xzio);
       grub_free (file);
 
@@ -235,9 +338,21 @@ grub_xzio_read (grub_file_t file, char *buf, grub_size_t len)
   grub_xzio_t xzio = file->data;
   grub_off_t current_offset;
 
-  /* If seek backward need to reset decoder and start from beginning of file.
-     TODO Possible improvement by jumping blocks.  */
-  if (file->offset < xzio->saved_offset)
+  /* Seeking backward or past the current block restarts decoding at the
+     block holding the new offset if there is a block index, else at the
+     beginning of file.  */
+  if (xzio->blocks
+      && (file->offset < xzio->saved_offset
+	  || in_later_block (xzio, file->offset)))
+    {
+      if (!seek_block (xzio, file->offset))
+	{
+	  grub_error (GRUB_ERR_BAD_COMPRESSED_DATA,
+		      N_("xz file corrupted or unsupported block options"));
+	  return -1;
+	}
+    }
+  else if (file->offset < xzio->saved_offset)
     {
       xz_dec_reset (xzio->dec);
       xzio->saved_offset = 0;
@@ -257,7 +372,12 @@ grub_xzio_read (grub_file_t file, char *buf, grub_size_t len)
       /* Feed input.  */
       if (xzio->buf.in_pos == xzio->buf.in_size)
 	{
-	  readret = grub_file_read (xzio->file, xzio->inbuf, XZBUFSIZ);
+	  grub_size_t toread = XZBUFSIZ;
+
+	  if (xzio->blocks
+	      && xzio->index_off - grub_file_tell (xzio->file) < toread)
+	    toread = xzio->index_off - grub_file_tell (xzio->file);
+	  readret = grub_file_read (xzio->file, xzio->inbuf, toread);
 	  if (readret < 0)
 	    return -1;
 	  xzio->buf.in_size = readret;
@@ -315,6 +435,7 @@ grub_xzio_close (grub_file_t file)
   xz_dec_end (xzio->dec);
 
   grub_file_close (xzio->file);
+  grub_free (xzio->blocks);
   grub_free (xzio);
 
   /* Device must not be closed twice.  */
@@ -25,26 +25,53 @@
 #include <grub/time.h>
 #include <grub/file.h>
 #include <grub/i18n.h>
+#if !defined (GRUB_UTIL) && !defined (GRUB_MACHINE_EMU)
+#include <grub/mm_private.h>
+#endif
 
 #define	GRUB_CACHE_TIMEOUT	2
 
 /* The last time the disk was used.  */
 static grub_uint64_t grub_last_time = 0;
 
-struct grub_disk_cache grub_disk_cache_table[GRUB_DISK_CACHE_NUM];
+/* The cache is split into sets of GRUB_DISK_CACHE_WAYS entries. A block
+   can go into any entry of the set its address hashes to and the least
+   recently used one is replaced when the set is full, so a few hot blocks
+   which happen to hash together don't keep evicting each other.  */
+struct grub_disk_cache *grub_disk_cache_table;
+unsigned grub_disk_cache_sets;
+static unsigned long grub_disk_cache_clock;
 
 void (*grub_disk_firmware_fini) (void);
 int grub_disk_firmware_is_tainted;
 
 #if DISK_CACHE_STATS
-static unsigned long grub_disk_cache_hits;
-static unsigned long grub_disk_cache_misses;
+struct grub_disk_cache_stats grub_disk_cache_stats[GRUB_DISK_CACHE_STATS_MAX];
 
-void
-grub_disk_cache_get_performance (unsigned long *hits, unsigned long *misses)
+/* Statistics slot of a disk. When all slots are taken the last one
+   collects the counts of all remaining disks.  */
+static struct grub_disk_cache_stats *
+grub_disk_cache_get_stats (enum grub_disk_dev_id dev_id,
+			   unsigned long disk_id)
 {
-  *hits = grub_disk_cache_hits;
-  *misses = grub_disk_cache_misses;
+  struct grub_disk_cache_stats *stats;
+
+  for (stats = grub_disk_cache_stats;
+       stats < grub_disk_cache_stats + GRUB_DISK_CACHE_STATS_MAX - 1;
+       stats++)
+    {
+      if (!stats->used)
+	{
+	  stats->used = 1;
+	  stats->dev_id = dev_id;
+	  stats->disk_id = disk_id;
+	}
+      if (stats->dev_id == dev_id && stats->disk_id == disk_id)
+	return stats;
+    }
+
+  stats->used = 1;
+  return stats;
 }
 #endif
 
@@ -55,12 +82,82 @@ grub_err_t (*grub_disk_write_weak) (grub_disk_t disk,
 				    const void *buf);
 #include "disk_common.c"
 
+/* Size the cache to a share of the heap, it's allocated on first use when
+   the memory map is known.  */
+static void
+grub_disk_cache_init (void)
+{
+  grub_size_t heap_size = 0;
+  unsigned sets;
+
+#if !defined (GRUB_UTIL) && !defined (GRUB_MACHINE_EMU)
+  grub_mm_region_t r;
+
+  for (r = grub_mm_base; r; r = r->next)
+    heap_size += r->size;
+#endif
+
+  for (sets = GRUB_DISK_CACHE_MAX_SETS; sets > GRUB_DISK_CACHE_MIN_SETS;
+       sets >>= 1)
+    if (((grub_size_t) sets * GRUB_DISK_CACHE_WAYS
+	 << (GRUB_DISK_CACHE_BITS + GRUB_DISK_SECTOR_BITS))
+	<= heap_size / GRUB_DISK_CACHE_HEAP_SHARE)
+      break;
+
+  if (!heap_size)
+    sets = GRUB_DISK_CACHE_DEFAULT_SETS;
+
+  for (; sets >= GRUB_DISK_CACHE_MIN_SETS; sets >>= 1)
+    {
+      grub_disk_cache_table = grub_zalloc (sets * GRUB_DISK_CACHE_WAYS
+					   * sizeof (*grub_disk_cache_table));
+      if (grub_disk_cache_table)
+	{
+	  grub_disk_cache_sets = sets;
+	  return;
+	}
+    }
+
+  grub_errno = GRUB_ERR_NONE;
+}
+
+static struct grub_disk_cache *
+grub_disk_cache_get_set (unsigned long dev_id, unsigned long disk_id,
+			 grub_disk_addr_t sector)
+{
+  unsigned index;
+
+  index = ((dev_id * 524287UL + disk_id * 2606459UL
+	    + ((unsigned) (sector >> GRUB_DISK_CACHE_BITS)))
+	   & (grub_disk_cache_sets - 1));
+  return grub_disk_cache_table + index * GRUB_DISK_CACHE_WAYS;
+}
+
+static struct grub_disk_cache *
+grub_disk_cache_find (unsigned long dev_id, unsigned long disk_id,
+		      grub_disk_addr_t sector)
+{
+  struct grub_disk_cache *cache;
+  unsigned i;
+
+  if (!grub_disk_cache_table)
+    return 0;
+
+  cache = grub_disk_cache_get_set (dev_id, disk_id, sector);
+  for (i = 0; i < GRUB_DISK_CACHE_WAYS; i++, cache++)
+    if (cache->data && cache->dev_id == dev_id && cache->disk_id == disk_id
+	&& cache->sector == sector)
+      return cache;
+
+  return 0;
+}
+
 void
 grub_disk_cache_invalidate_all (void)
 {
   unsigned i;
 
-  for (i = 0; i < GRUB_DISK_CACHE_NUM; i++)
+  for (i = 0; i < grub_disk_cache_sets * GRUB_DISK_CACHE_WAYS; i++)
     {
       struct grub_disk_cache *cache = grub_disk_cache_table + i;
 
@@ -72,28 +169,42 @@ grub_disk_cache_invalidate_all (void)
     }
 }
 
+void
+grub_disk_cache_invalidate (unsigned long dev_id, unsigned long disk_id,
+			    grub_disk_addr_t sector)
+{
+  struct grub_disk_cache *cache;
+
+  sector &= ~((grub_disk_addr_t) GRUB_DISK_CACHE_SIZE - 1);
+  cache = grub_disk_cache_find (dev_id, disk_id, sector);
+  if (cache)
+    {
+      cache->lock = 1;
+      grub_free (cache->data);
+      cache->data = 0;
+      cache->lock = 0;
+    }
+}
+
 static char *
 grub_disk_cache_fetch (unsigned long dev_id, unsigned long disk_id,
 		       grub_disk_addr_t sector)
 {
   struct grub_disk_cache *cache;
-  unsigned cache_index;
-
-  cache_index = grub_disk_cache_get_index (dev_id, disk_id, sector);
-  cache = grub_disk_cache_table + cache_index;
 
-  if (cache->dev_id == dev_id && cache->disk_id == disk_id
-      && cache->sector == sector)
+  cache = grub_disk_cache_find (dev_id, disk_id, sector);
+  if (cache)
     {
       cache->lock = 1;
+      cache->last_use = ++grub_disk_cache_clock;
 #if DISK_CACHE_STATS
-      grub_disk_cache_hits++;
+      grub_disk_cache_get_stats (dev_id, disk_id)->hits++;
 #endif
       return cache->data;
     }
 
 #if DISK_CACHE_STATS
-  grub_disk_cache_misses++;
+  grub_disk_cache_get_stats (dev_id, disk_id)->misses++;
 #endif
 
   return 0;
@@ -104,13 +215,9 @@ grub_disk_cache_unlock (unsigned long dev_id, unsigned long disk_id,
 			grub_disk_addr_t sector)
 {
   struct grub_disk_cache *cache;
-  unsigned cache_index;
-
-  cache_index = grub_disk_cache_get_index (dev_id, disk_id, sector);
-  cache = grub_disk_cache_table + cache_index;
 
-  if (cache->dev_id == dev_id && cache->disk_id == disk_id
-      && cache->sector == sector)
+  cache = grub_disk_cache_find (dev_id, disk_id, sector);
+  if (cache)
     cache->lock = 0;
 }
 
@@ -118,31 +225,71 @@ static grub_err_t
 grub_disk_cache_store (unsigned long dev_id, unsigned long disk_id,
 		       grub_disk_addr_t sector, const char *data)
 {
-  unsigned cache_index;
-  struct grub_disk_cache *cache;
+  struct grub_disk_cache *cache, *victim = 0;
+  unsigned i;
+
+  if (!grub_disk_cache_table)
+    {
+      grub_disk_cache_init ();
+      if (!grub_disk_cache_table)
+	return GRUB_ERR_NONE;
+    }
 
-  cache_index = grub_disk_cache_get_index (dev_id, disk_id, sector);
-  cache = grub_disk_cache_table + cache_index;
+  /* Take the entry already holding the block, else a free one, else the
+     least recently used one which isn't locked.  */
+  cache = grub_disk_cache_get_set (dev_id, disk_id, sector);
+  for (i = 0; i < GRUB_DISK_CACHE_WAYS; i++, cache++)
+    {
+      if (cache->lock)
+	continue;
+      if (!cache->data)
+	{
+	  if (!victim || victim->data)
+	    victim = cache;
+	  continue;
+	}
+      if (cache->dev_id == dev_id && cache->disk_id == disk_id
+	  && cache->sector == sector)
+	{
+	  victim = cache;
+	  break;
+	}
+      if (!victim || (victim->data && cache->last_use < victim->last_use))
+	victim = cache;
+    }
 
-  cache->lock = 1;
-  grub_free (cache->data);
-  cache->data = 0;
-  cache->lock = 0;
+  if (!victim)
+    return GRUB_ERR_NONE;
 
-  cache->data = grub_malloc (GRUB_DISK_SECTOR_SIZE << GRUB_DISK_CACHE_BITS);
-  if (! cache->data)
-    return grub_errno;
+  if (victim->data)
+    {
+#if DISK_CACHE_STATS
+      if (victim->dev_id != dev_id || victim->disk_id != disk_id
+	  || victim->sector != sector)
+	grub_disk_cache_get_stats (victim->dev_id,
+				   victim->disk_id)->evictions++;
+#endif
+    }
+  else
+    {
+      victim->data = grub_malloc (GRUB_DISK_SECTOR_SIZE
+				  << GRUB_DISK_CACHE_BITS);
+      if (! victim->data)
+	return grub_errno;
+    }
 
-  grub_memcpy (cache->data, data,
+  /* The evicted block's buffer is reused as is.  */
+  grub_memcpy (victim->data, data,
 	       GRUB_DISK_SECTOR_SIZE << GRUB_DISK_CACHE_BITS);
-  cache->dev_id = dev_id;
-  cache->disk_id = disk_id;
-  cache->sector = sector;
+  victim->dev_id = dev_id;
+  victim->disk_id = disk_id;
+  victim->sector = sector;
+  victim->last_use = ++grub_disk_cache_clock;
 
   return GRUB_ERR_NONE;
 }
 
-
+
 
 grub_disk_dev_t grub_disk_dev_list;
 
@@ -310,6 +457,79 @@ grub_disk_close (grub_disk_t disk)
   grub_free (disk);
 }
 
+/* Read up to DISK->ra_window cache blocks starting at the one at SECTOR
+   with a single driver call, store them in the cache and copy the
+   requested part of the first one to BUF. Stops before the first block
+   which is cached already. Returns 1 if it handled the read, else the
+   caller has to read the block on its own.  */
+static int
+grub_disk_read_ahead (grub_disk_t disk, grub_disk_addr_t sector,
+		      grub_off_t offset, grub_size_t size, void *buf)
+{
+  unsigned window, n, i;
+  char *tmp_buf;
+
+  window = disk->ra_window;
+  if (window > GRUB_DISK_READAHEAD_MAX)
+    window = GRUB_DISK_READAHEAD_MAX;
+  if (window > disk->max_agglomerate)
+    window = disk->max_agglomerate;
+  /* Don't let a single window flush most of the cache.  */
+  if (grub_disk_cache_sets
+      && window > grub_disk_cache_sets * GRUB_DISK_CACHE_WAYS / 4)
+    window = grub_disk_cache_sets * GRUB_DISK_CACHE_WAYS / 4;
+  if (disk->total_sectors != GRUB_DISK_SIZE_UNKNOWN)
+    {
+      grub_disk_addr_t total;
+
+      total = disk->total_sectors << (disk->log_sector_size
+				      - GRUB_DISK_SECTOR_BITS);
+      if (sector >= total)
+	return 0;
+      if (window > (total - sector) >> GRUB_DISK_CACHE_BITS)
+	window = (total - sector) >> GRUB_DISK_CACHE_BITS;
+    }
+
+  for (n = 1; n < window; n++)
+    if (grub_disk_cache_find (disk->dev->id, disk->id,
+			      sector + (n << GRUB_DISK_CACHE_BITS)))
+      break;
+  if (n < 2)
+    return 0;
+
+  tmp_buf = grub_malloc (n << (GRUB_DISK_CACHE_BITS + GRUB_DISK_SECTOR_BITS));
+  if (!tmp_buf)
+    {
+      grub_errno = GRUB_ERR_NONE;
+      return 0;
+    }
+
+  if ((disk->dev->read) (disk, transform_sector (disk, sector),
+			 n << (GRUB_DISK_CACHE_BITS + GRUB_DISK_SECTOR_BITS
+			       - disk->log_sector_size), tmp_buf))
+    {
+      /* Let the caller retry with just the block it needs.  */
+      grub_free (tmp_buf);
+      grub_errno = GRUB_ERR_NONE;
+      disk->ra_window = 0;
+      return 0;
+    }
+
+  grub_memcpy (buf, tmp_buf + offset, size);
+  for (i = 0; i < n; i++)
+    grub_disk_cache_store (disk->dev->id, disk->id,
+			   sector + (i << GRUB_DISK_CACHE_BITS),
+			   tmp_buf + (i << (GRUB_DISK_CACHE_BITS
+					    + GRUB_DISK_SECTOR_BITS)));
+  grub_free (tmp_buf);
+  grub_errno = GRUB_ERR_NONE;
+
+  if (disk->ra_window < GRUB_DISK_READAHEAD_MAX)
+    disk->ra_window *= 2;
+
+  return 1;
+}
+
 /* Small read (less than cache size and not pass across cache unit boundaries).
    sector is already adjusted and is divisible by cache unit size.
  */
@@ -330,6 +550,10 @@ grub_disk_read_small_real (grub_disk_t disk, grub_disk_addr_t sector,
       return GRUB_ERR_NONE;
     }
 
+  if (disk->ra_window
+      && grub_disk_read_ahead (disk, sector, offset, size, buf))
+    return GRUB_ERR_NONE;
+
   /* Allocate a temporary buffer.  */
   tmp_buf = grub_malloc (GRUB_DISK_SECTOR_SIZE << GRUB_DISK_CACHE_BITS);
   if (! tmp_buf)
@@ -423,6 +647,25 @@ grub_disk_read (grub_disk_t disk, grub_disk_addr_t sector,
       return grub_errno;
     }
 
+  /* Reads continuing in the cache block after the last one read turn
+     read-ahead on, anything but staying in the same block turns it off.  */
+  if (size)
+    {
+      grub_disk_addr_t first, last;
+
+      first = sector & ~((grub_disk_addr_t) GRUB_DISK_CACHE_SIZE - 1);
+      last = (sector + ((offset + size - 1) >> GRUB_DISK_SECTOR_BITS))
+	& ~((grub_disk_addr_t) GRUB_DISK_CACHE_SIZE - 1);
+      if (first == disk->ra_last + GRUB_DISK_CACHE_SIZE)
+	{
+	  if (disk->ra_window < GRUB_DISK_READAHEAD_MIN)
+	    disk->ra_window = GRUB_DISK_READAHEAD_MIN;
+	}
+      else if (first != disk->ra_last)
+	disk->ra_window = 0;
+      disk->ra_last = last;
+    }
+
   /* First read until first cache boundary.   */
   if (offset || (sector & (GRUB_DISK_CACHE_SIZE - 1)))
     {
@@ -0,0 +1,348 @@
+/*
+ *  GRUB  --  GRand Unified Bootloader
+ *  Copyright (C) 2024  Free Software Foundation, Inc.
+ *
+ *  GRUB is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  GRUB is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with GRUB.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/* AES using the AES-NI instructions on x86_64 and the ARMv8 Cryptography
+   Extensions on arm64. If the CPU has them, the module registers cipher
+   specs under the names of the gcry_rijndael ones, which it depends on.
+   Being registered last they are found first, so everything looking up AES
+   by name uses them. Otherwise the portable implementation stays in use.
+
+   The rest of GRUB is built without SSE or SIMD, so the vector registers
+   are only touched from the assembly here. Only registers the firmware
+   calling convention treats as scratch are used, and they're cleared
+   afterwards.  */
+
+#include <grub/types.h>
+#include <grub/misc.h>
+#include <grub/crypto.h>
+#include <grub/dl.h>
+#ifdef __x86_64__
+#include <grub/i386/cpuid.h>
+#endif
+
+GRUB_MOD_LICENSE ("GPLv3+");
+
+#define AES_BLOCK_SIZE	16
+#define AES_MAX_ROUNDS	14
+
+struct aes_hw_context
+{
+  grub_uint8_t ek[AES_MAX_ROUNDS + 1][AES_BLOCK_SIZE];
+  grub_uint8_t dk[AES_MAX_ROUNDS + 1][AES_BLOCK_SIZE];
+  int rounds;
+};
+
+extern gcry_cipher_spec_t _gcry_cipher_spec_aes192;
+extern gcry_cipher_spec_t _gcry_cipher_spec_aes256;
+
+static const grub_uint8_t sbox[256] =
+  {
+    0x63, 0x7c, 0x77, 0x7b, 0xf2, 0x6b, 0x6f, 0xc5,
+    0x30, 0x01, 0x67, 0x2b, 0xfe, 0xd7, 0xab, 0x76,
+    0xca, 0x82, 0xc9, 0x7d, 0xfa, 0x59, 0x47, 0xf0,
+    0xad, 0xd4, 0xa2, 0xaf, 0x9c, 0xa4, 0x72, 0xc0,
+    0xb7, 0xfd, 0x93, 0x26, 0x36, 0x3f, 0xf7, 0xcc,
+    0x34, 0xa5, 0xe5, 0xf1, 0x71, 0xd8, 0x31, 0x15,
+    0x04, 0xc7, 0x23, 0xc3, 0x18, 0x96, 0x05, 0x9a,
+    0x07, 0x12, 0x80, 0xe2, 0xeb, 0x27, 0xb2, 0x75,
+    0x09, 0x83, 0x2c, 0x1a, 0x1b, 0x6e, 0x5a, 0xa0,
+    0x52, 0x3b, 0xd6, 0xb3, 0x29, 0xe3, 0x2f, 0x84,
+    0x53, 0xd1, 0x00, 0xed, 0x20, 0xfc, 0xb1, 0x5b,
+    0x6a, 0xcb, 0xbe, 0x39, 0x4a, 0x4c, 0x58, 0xcf,
+    0xd0, 0xef, 0xaa, 0xfb, 0x43, 0x4d, 0x33, 0x85,
+    0x45, 0xf9, 0x02, 0x7f, 0x50, 0x3c, 0x9f, 0xa8,
+    0x51, 0xa3, 0x40, 0x8f, 0x92, 0x9d, 0x38, 0xf5,
+    0xbc, 0xb6, 0xda, 0x21, 0x10, 0xff, 0xf3, 0xd2,
+    0xcd, 0x0c, 0x13, 0xec, 0x5f, 0x97, 0x44, 0x17,
+    0xc4, 0xa7, 0x7e, 0x3d, 0x64, 0x5d, 0x19, 0x73,
+    0x60, 0x81, 0x4f, 0xdc, 0x22, 0x2a, 0x90, 0x88,
+    0x46, 0xee, 0xb8, 0x14, 0xde, 0x5e, 0x0b, 0xdb,
+    0xe0, 0x32, 0x3a, 0x0a, 0x49, 0x06, 0x24, 0x5c,
+    0xc2, 0xd3, 0xac, 0x62, 0x91, 0x95, 0xe4, 0x79,
+    0xe7, 0xc8, 0x37, 0x6d, 0x8d, 0xd5, 0x4e, 0xa9,
+    0x6c, 0x56, 0xf4, 0xea, 0x65, 0x7a, 0xae, 0x08,
+    0xba, 0x78, 0x25, 0x2e, 0x1c, 0xa6, 0xb4, 0xc6,
+    0xe8, 0xdd, 0x74, 0x1f, 0x4b, 0xbd, 0x8b, 0x8a,
+    0x70, 0x3e, 0xb5, 0x66, 0x48, 0x03, 0xf6, 0x0e,
+    0x61, 0x35, 0x57, 0xb9, 0x86, 0xc1, 0x1d, 0x9e,
+    0xe1, 0xf8, 0x98, 0x11, 0x69, 0xd9, 0x8e, 0x94,
+    0x9b, 0x1e, 0x87, 0xe9, 0xce, 0x55, 0x28, 0xdf,
+    0x8c, 0xa1, 0x89, 0x0d, 0xbf, 0xe6, 0x42, 0x68,
+    0x41, 0x99, 0x2d, 0x0f, 0xb0, 0x54, 0xbb, 0x16
+  };
+
+#ifdef __x86_64__
+
+static int
+aes_hw_supported (void)
+{
+  grub_uint32_t eax, ebx, ecx, edx;
+
+  if (!grub_cpu_is_cpuid_supported ())
+    return 0;
+
+  grub_cpuid (0, eax, ebx, ecx, edx);
+  if (eax < 1)
+    return 0;
+
+  /* UEFI requires SSE to be enabled on x86_64, so only the instructions
+     need checking.  */
+  grub_cpuid (1, eax, ebx, ecx, edx);
+  return !!(ecx & (1 << 25));
+}
+
+/* Load the round keys unaligned, the context follows the cipher pointer
+   in grub_crypto_cipher_handle and needn't be 16 byte aligned.  */
+static void
+aes_hw_encrypt (void *context, unsigned char *out, const unsigned char *in)
+{
+  const struct aes_hw_context *ctx = context;
+  const grub_uint8_t *k = ctx->ek[0];
+  unsigned long n = ctx->rounds - 1;
+
+  asm volatile ("movdqu (%[in]), %%xmm0\n\t"
+		"movdqu (%[k]), %%xmm1\n\t"
+		"pxor %%xmm1, %%xmm0\n"
+		"1:\n\t"
+		"add $16, %[k]\n\t"
+		"movdqu (%[k]), %%xmm1\n\t"
+		"aesenc %%xmm1, %%xmm0\n\t"
+		"dec %[n]\n\t"
+		"jnz 1b\n\t"
+		"movdqu 16(%[k]), %%xmm1\n\t"
+		"aesenclast %%xmm1, %%xmm0\n\t"
+		"movdqu %%xmm0, (%[out])\n\t"
+		"pxor %%xmm0, %%xmm0\n\t"
+		"pxor %%xmm1, %%xmm1\n"
+		: [k] "+r" (k), [n] "+r" (n)
+		: [in] "r" (in), [out] "r" (out)
+		: "cc", "memory");
+}
+
+static void
+aes_hw_decrypt (void *context, unsigned char *out, const unsigned char *in)
+{
+  const struct aes_hw_context *ctx = context;
+  const grub_uint8_t *k = ctx->dk[0];
+  unsigned long n = ctx->rounds - 1;
+
+  asm volatile ("movdqu (%[in]), %%xmm0\n\t"
+		"movdqu (%[k]), %%xmm1\n\t"
+		"pxor %%xmm1, %%xmm0\n"
+		"1:\n\t"
+		"add $16, %[k]\n\t"
+		"movdqu (%[k]), %%xmm1\n\t"
+		"aesdec %%xmm1, %%xmm0\n\t"
+		"dec %[n]\n\t"
+		"jnz 1b\n\t"
+		"movdqu 16(%[k]), %%xmm1\n\t"
+		"aesdeclast %%xmm1, %%xmm0\n\t"
+		"movdqu %%xmm0, (%[out])\n\t"
+		"pxor %%xmm0, %%xmm0\n\t"
+		"pxor %%xmm1, %%xmm1\n"
+		: [k] "+r" (k), [n] "+r" (n)
+		: [in] "r" (in), [out] "r" (out)
+		: "cc", "memory");
+}
+
+/* InvMixColumns, for the round keys of the equivalent inverse cipher.  */
+static void
+aes_hw_inv_mix_columns (grub_uint8_t *out, const grub_uint8_t *in)
+{
+  asm volatile ("movdqu (%[in]), %%xmm0\n\t"
+		"aesimc %%xmm0, %%xmm0\n\t"
+		"movdqu %%xmm0, (%[out])\n\t"
+		"pxor %%xmm0, %%xmm0\n"
+		:
+		: [in] "r" (in), [out] "r" (out)
+		: "memory");
+}
+
+#elif defined (__aarch64__)
+
+#define ID_AA64ISAR0_AES_SHIFT	4
+#define ID_AA64ISAR0_AES_MASK	0xf
+
+static int
+aes_hw_supported (void)
+{
+  grub_uint64_t isar0;
+
+  /* FP and SIMD are enabled by the firmware, UEFI requires it.  */
+  asm volatile ("mrs %0, id_aa64isar0_el1" : "=r" (isar0));
+  return ((isar0 >> ID_AA64ISAR0_AES_SHIFT) & ID_AA64ISAR0_AES_MASK) != 0;
+}
+
+/* v0-v7 and v16-v31 are the caller saved vector registers.  */
+static void
+aes_hw_encrypt (void *context, unsigned char *out, const unsigned char *in)
+{
+  const struct aes_hw_context *ctx = context;
+  const grub_uint8_t *k = ctx->ek[0];
+  unsigned long n = ctx->rounds - 1;
+
+  asm volatile (".arch_extension crypto\n\t"
+		"ld1 {v0.16b}, [%[in]]\n"
+		"1:\n\t"
+		"ld1 {v1.16b}, [%[k]], #16\n\t"
+		"aese v0.16b, v1.16b\n\t"
+		"aesmc v0.16b, v0.16b\n\t"
+		"subs %[n], %[n], #1\n\t"
+		"b.ne 1b\n\t"
+		"ld1 {v1.16b, v2.16b}, [%[k]]\n\t"
+		"aese v0.16b, v1.16b\n\t"
+		"eor v0.16b, v0.16b, v2.16b\n\t"
+		"st1 {v0.16b}, [%[out]]\n\t"
+		"movi v0.16b, #0\n\t"
+		"movi v1.16b, #0\n\t"
+		"movi v2.16b, #0\n"
+		: [k] "+r" (k), [n] "+r" (n)
+		: [in] "r" (in), [out] "r" (out)
+		: "cc", "memory");
+}
+
+static void
+aes_hw_decrypt (void *context, unsigned char *out, const unsigned char *in)
+{
+  const struct aes_hw_context *ctx = context;
+  const grub_uint8_t *k = ctx->dk[0];
+  unsigned long n = ctx->rounds - 1;
+
+  asm volatile (".arch_extension crypto\n\t"
+		"ld1 {v0.16b}, [%[in]]\n"
+		"1:\n\t"
+		"ld1 {v1.16b}, [%[k]], #16\n\t"
+		"aesd v0.16b, v1.16b\n\t"
+		"aesimc v0.16b, v0.16b\n\t"
+		"subs %[n], %[n], #1\n\t"
+		"b.ne 1b\n\t"
+		"ld1 {v1.16b, v2.16b}, [%[k]]\n\t"
+		"aesd v0.16b, v1.16b\n\t"
+		"eor v0.16b, v0.16b, v2.16b\n\t"
+		"st1 {v0.16b}, [%[out]]\n\t"
+		"movi v0.16b, #0\n\t"
+		"movi v1.16b, #0\n\t"
+		"movi v2.16b, #0\n"
+		: [k] "+r" (k), [n] "+r" (n)
+		: [in] "r" (in), [out] "r" (out)
+		: "cc", "memory");
+}
+
+static void
+aes_hw_inv_mix_columns (grub_uint8_t *out, const grub_uint8_t *in)
+{
+  asm volatile (".arch_extension crypto\n\t"
+		"ld1 {v0.16b}, [%[in]]\n\t"
+		"aesimc v0.16b, v0.16b\n\t"
+		"st1 {v0.16b}, [%[out]]\n\t"
+		"movi v0.16b, #0\n"
+		:
+		: [in] "r" (in), [out] "r" (out)
+		: "memory");
+}
+
+#else
+#error "No AES instructions for this CPU"
+#endif
+
+/* The FIPS-197 key expansion. The decryption keys are those of the
+   equivalent inverse cipher, which the decryption instructions of both
+   architectures implement.  */
+static gcry_err_code_t
+aes_hw_setkey (void *context, const unsigned char *key, unsigned keylen)
+{
+  struct aes_hw_context *ctx = context;
+  grub_uint8_t *w = ctx->ek[0];
+  unsigned nk = keylen / 4, i;
+  grub_uint8_t rcon = 1;
+
+  if (keylen != 16 && keylen != 24 && keylen != 32)
+    return GPG_ERR_INV_KEYLEN;
+
+  ctx->rounds = nk + 6;
+  grub_memcpy (w, key, keylen);
+
+  for (i = nk; i < 4 * (unsigned) (ctx->rounds + 1); i++)
+    {
+      grub_uint8_t t[4];
+
+      grub_memcpy (t, w + 4 * (i - 1), 4);
+      if (i % nk == 0)
+	{
+	  grub_uint8_t t0 = t[0];
+
+	  t[0] = sbox[t[1]] ^ rcon;
+	  t[1] = sbox[t[2]];
+	  t[2] = sbox[t[3]];
+	  t[3] = sbox[t0];
+	  rcon = (rcon << 1) ^ ((rcon & 0x80) ? 0x1b : 0);
+	}
+      else if (nk > 6 && i % nk == 4)
+	{
+	  t[0] = sbox[t[0]];
+	  t[1] = sbox[t[1]];
+	  t[2] = sbox[t[2]];
+	  t[3] = sbox[t[3]];
+	}
+      w[4 * i] = w[4 * (i - nk)] ^ t[0];
+      w[4 * i + 1] = w[4 * (i - nk) + 1] ^ t[1];
+      w[4 * i + 2] = w[4 * (i - nk) + 2] ^ t[2];
+      w[4 * i + 3] = w[4 * (i - nk) + 3] ^ t[3];
+    }
+
+  grub_memcpy (ctx->dk[0], ctx->ek[ctx->rounds], AES_BLOCK_SIZE);
+  for (i = 1; i < (unsigned) ctx->rounds; i++)
+    aes_hw_inv_mix_columns (ctx->dk[i], ctx->ek[ctx->rounds - i]);
+  grub_memcpy (ctx->dk[ctx->rounds], ctx->ek[0], AES_BLOCK_SIZE);
+
+  return GPG_ERR_NO_ERROR;
+}
+
+static gcry_cipher_spec_t aes_hw_specs[3];
+
+GRUB_MOD_INIT(aes_hw)
+{
+  gcry_cipher_spec_t *portable[3] = { &_gcry_cipher_spec_aes,
+				      &_gcry_cipher_spec_aes192,
+				      &_gcry_cipher_spec_aes256 };
+  unsigned i;
+
+  if (!aes_hw_supported ())
+    return;
+
+  for (i = 0; i < ARRAY_SIZE (aes_hw_specs); i++)
+    {
+      aes_hw_specs[i] = *portable[i];
+      aes_hw_specs[i].contextsize = sizeof (struct aes_hw_context);
+      aes_hw_specs[i].setkey = aes_hw_setkey;
+      aes_hw_specs[i].encrypt = aes_hw_encrypt;
+      aes_hw_specs[i].decrypt = aes_hw_decrypt;
+      aes_hw_specs[i].stencrypt = NULL;
+      aes_hw_specs[i].stdecrypt = NULL;
+      grub_cipher_register (&aes_hw_specs[i]);
+    }
+}
+
+GRUB_MOD_FINI(aes_hw)
+{
+  unsigned i;
+
+  /* Unregistering a spec which was never registered is harmless.  */
+  for (i = 0; i < ARRAY_SIZE (aes_hw_specs); i++)
+    grub_cipher_unregister (&aes_hw_specs[i]);
+}
@@ -79,6 +79,31 @@ cpio_get_last (cpio_newc_header_t * hdr)
   return hdr;
 }
 
+cpio_newc_header_t *
+cpio_find_trailer (void *start, grub_size_t size)
+{
+  grub_size_t trailer_size = sizeof (cpio_newc_header_t)
+    + sizeof (CPIO_TRAILER);
+  grub_size_t off;
+
+  if (size < trailer_size)
+    return NULL;
+
+  // the archive may be padded, so walk back over 4 byte aligned headers
+  for (off = (size - trailer_size) & ~3; ; off -= 4)
+    {
+      cpio_newc_header_t *hdr = (cpio_newc_header_t *) ((char *) start + off);
+
+      if (cpio_is_valid (hdr) && !cpio_has_next (hdr))
+	return hdr;
+
+      if (off == 0)
+	break;
+    }
+
+  return NULL;
+}
+
 cpio_newc_header_t *
 cpio_create_obj (cpio_newc_header_t * hdr, const char *name, const void *data,
 		 grub_size_t data_size)
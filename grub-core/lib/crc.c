@@ -20,7 +20,15 @@
 #include <grub/types.h>
 #include <grub/lib/crc.h>
 
-static grub_uint32_t crc32c_table [256];
+/* Slicing-by-8 tables, the first one is the usual byte at a time table.
+   crc32c_table[k][i] is the CRC of byte I followed by K zero bytes.  */
+static grub_uint32_t crc32c_table [8][256];
+
+typedef grub_uint32_t (*crc32c_func_t) (grub_uint32_t crc,
+					const grub_uint8_t *data,
+					grub_size_t size);
+
+static crc32c_func_t crc32c_func;
 
 /* Helper for init_crc32c_table.  */
 static grub_uint32_t
@@ -47,30 +55,152 @@ init_crc32c_table (void)
 
   for(i = 0; i < 256; i++)
     {
-      crc32c_table[i] = reflect(i, 8) << 24;
+      crc32c_table[0][i] = reflect(i, 8) << 24;
       for (j = 0; j < 8; j++)
-        crc32c_table[i] = (crc32c_table[i] << 1) ^
-            (crc32c_table[i] & (1 << 31) ? polynomial : 0);
-      crc32c_table[i] = reflect(crc32c_table[i], 32);
+        crc32c_table[0][i] = (crc32c_table[0][i] << 1) ^
+            (crc32c_table[0][i] & (1 << 31) ? polynomial : 0);
+      crc32c_table[0][i] = reflect(crc32c_table[0][i], 32);
     }
+
+  for (j = 1; j < 8; j++)
+    for (i = 0; i < 256; i++)
+      crc32c_table[j][i] = (crc32c_table[j - 1][i] >> 8)
+	^ crc32c_table[0][crc32c_table[j - 1][i] & 0xff];
 }
 
-grub_uint32_t
-grub_getcrc32c (grub_uint32_t crc, const void *buf, int size)
+static grub_uint32_t
+crc32c_slice8 (grub_uint32_t crc, const grub_uint8_t *data, grub_size_t size)
 {
-  int i;
-  const grub_uint8_t *data = buf;
+  for (; size && ((grub_addr_t) data & 7); size--, data++)
+    crc = (crc >> 8) ^ crc32c_table[0][(crc & 0xff) ^ *data];
+
+  for (; size >= 8; size -= 8, data += 8)
+    {
+      const grub_uint32_t *words = (const void *) data;
+      grub_uint32_t lo, hi;
+
+      lo = grub_le_to_cpu32 (words[0]) ^ crc;
+      hi = grub_le_to_cpu32 (words[1]);
+      crc = crc32c_table[7][lo & 0xff]
+	^ crc32c_table[6][(lo >> 8) & 0xff]
+	^ crc32c_table[5][(lo >> 16) & 0xff]
+	^ crc32c_table[4][lo >> 24]
+	^ crc32c_table[3][hi & 0xff]
+	^ crc32c_table[2][(hi >> 8) & 0xff]
+	^ crc32c_table[1][(hi >> 16) & 0xff]
+	^ crc32c_table[0][hi >> 24];
+    }
+
+  for (; size; size--, data++)
+    crc = (crc >> 8) ^ crc32c_table[0][(crc & 0xff) ^ *data];
+
+  return crc;
+}
+
+#if defined (__x86_64__)
 
-  if (! crc32c_table[1])
-    init_crc32c_table ();
+#define CRC32C_HW	1
+
+/* The SSE4.2 crc32 instruction, which only works on general purpose
+   registers.  */
+static int
+crc32c_hw_supported (void)
+{
+  grub_uint32_t eax, ebx, ecx, edx;
 
-  crc^= 0xffffffff;
+  asm volatile ("cpuid"
+		: "=a" (eax), "=b" (ebx), "=c" (ecx), "=d" (edx)
+		: "0" (0));
+  if (eax < 1)
+    return 0;
 
-  for (i = 0; i < size; i++)
+  asm volatile ("cpuid"
+		: "=a" (eax), "=b" (ebx), "=c" (ecx), "=d" (edx)
+		: "0" (1));
+  return !!(ecx & (1 << 20));
+}
+
+static grub_uint32_t
+crc32c_hw (grub_uint32_t crc, const grub_uint8_t *data, grub_size_t size)
+{
+  grub_uint64_t crc64 = crc;
+
+  for (; size && ((grub_addr_t) data & 7); size--, data++)
+    asm ("crc32b %1, %k0" : "+r" (crc64) : "rm" (*data));
+
+  for (; size >= 8; size -= 8, data += 8)
+    asm ("crc32q %1, %0"
+	 : "+r" (crc64) : "rm" (*(const grub_uint64_t *) (const void *) data));
+
+  for (; size; size--, data++)
+    asm ("crc32b %1, %k0" : "+r" (crc64) : "rm" (*data));
+
+  return crc64;
+}
+
+#elif defined (__aarch64__) && defined (GRUB_MACHINE_EFI)
+
+#define CRC32C_HW	1
+
+/* The ARMv8 CRC32 instructions. ID_AA64ISAR0_EL1 can only be read at EL1
+   and above, hence the restriction to firmware.  */
+#define ID_AA64ISAR0_CRC32_SHIFT	16
+#define ID_AA64ISAR0_CRC32_MASK		0xf
+
+static int
+crc32c_hw_supported (void)
+{
+  grub_uint64_t isar0;
+
+  asm volatile ("mrs %0, id_aa64isar0_el1" : "=r" (isar0));
+  return ((isar0 >> ID_AA64ISAR0_CRC32_SHIFT)
+	  & ID_AA64ISAR0_CRC32_MASK) != 0;
+}
+
+static grub_uint32_t
+crc32c_hw (grub_uint32_t crc, const grub_uint8_t *data, grub_size_t size)
+{
+  for (; size && ((grub_addr_t) data & 7); size--, data++)
+    asm (".arch_extension crc\n\t"
+	 "crc32cb %w0, %w0, %w1" : "+r" (crc) : "r" (*data));
+
+  for (; size >= 8; size -= 8, data += 8)
+    asm (".arch_extension crc\n\t"
+	 "crc32cx %w0, %w0, %x1"
+	 : "+r" (crc) : "r" (*(const grub_uint64_t *) (const void *) data));
+
+  for (; size; size--, data++)
+    asm (".arch_extension crc\n\t"
+	 "crc32cb %w0, %w0, %w1" : "+r" (crc) : "r" (*data));
+
+  return crc;
+}
+
+#endif
+
+static void
+init_crc32c (void)
+{
+#ifdef CRC32C_HW
+  if (crc32c_hw_supported ())
     {
-      crc = (crc >> 8) ^ crc32c_table[(crc & 0xFF) ^ *data];
-      data++;
+      crc32c_func = crc32c_hw;
+      return;
     }
+#endif
+
+  init_crc32c_table ();
+  crc32c_func = crc32c_slice8;
+}
+
+grub_uint32_t
+grub_getcrc32c (grub_uint32_t crc, const void *buf, int size)
+{
+  if (! crc32c_func)
+    init_crc32c ();
+
+  if (size <= 0)
+    return crc;
 
-  return crc ^ 0xffffffff;
+  return crc32c_func (crc ^ 0xffffffff, buf, size) ^ 0xffffffff;
 }
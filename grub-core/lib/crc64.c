@@ -23,7 +23,9 @@
 
 GRUB_MOD_LICENSE ("GPLv3+");
 
-static grub_uint64_t crc64_table [256];
+/* Slicing-by-8 tables, the first one is the usual byte at a time table.
+   crc64_table[k][i] is the CRC of byte I followed by K zero bytes.  */
+static grub_uint64_t crc64_table [8][256];
 
 /* Helper for init_crc64_table.  */
 static grub_uint64_t
@@ -50,20 +52,25 @@ init_crc64_table (void)
 
   for(i = 0; i < 256; i++)
     {
-      crc64_table[i] = reflect(i, 8) << 56;
+      crc64_table[0][i] = reflect(i, 8) << 56;
       for (j = 0; j < 8; j++)
 	{
-	  crc64_table[i] = (crc64_table[i] << 1) ^
-            (crc64_table[i] & (1ULL << 63) ? polynomial : 0);
+	  crc64_table[0][i] = (crc64_table[0][i] << 1) ^
+            (crc64_table[0][i] & (1ULL << 63) ? polynomial : 0);
 	}
-      crc64_table[i] = reflect(crc64_table[i], 64);
+      crc64_table[0][i] = reflect(crc64_table[0][i], 64);
     }
+
+  for (j = 1; j < 8; j++)
+    for (i = 0; i < 256; i++)
+      crc64_table[j][i] = (crc64_table[j - 1][i] >> 8)
+	^ crc64_table[0][crc64_table[j - 1][i] & 0xff];
 }
 
 static void
 crc64_init (void *context)
 {
-  if (! crc64_table[1])
+  if (! crc64_table[0][1])
     init_crc64_table ();
   *(grub_uint64_t *) context = 0;
 }
@@ -71,16 +78,28 @@ crc64_init (void *context)
 static void
 crc64_write (void *context, const void *buf, grub_size_t size)
 {
-  unsigned i;
   const grub_uint8_t *data = buf;
   grub_uint64_t crc = ~grub_le_to_cpu64 (*(grub_uint64_t *) context);
 
-  for (i = 0; i < size; i++)
+  for (; size && ((grub_addr_t) data & 7); size--, data++)
+    crc = (crc >> 8) ^ crc64_table[0][(crc & 0xff) ^ *data];
+
+  for (; size >= 8; size -= 8, data += 8)
     {
-      crc = (crc >> 8) ^ crc64_table[(crc & 0xFF) ^ *data];
-      data++;
+      crc ^= grub_le_to_cpu64 (*(const grub_uint64_t *) (const void *) data);
+      crc = crc64_table[7][crc & 0xff]
+	^ crc64_table[6][(crc >> 8) & 0xff]
+	^ crc64_table[5][(crc >> 16) & 0xff]
+	^ crc64_table[4][(crc >> 24) & 0xff]
+	^ crc64_table[3][(crc >> 32) & 0xff]
+	^ crc64_table[2][(crc >> 40) & 0xff]
+	^ crc64_table[1][(crc >> 48) & 0xff]
+	^ crc64_table[0][crc >> 56];
     }
 
+  for (; size; size--, data++)
+    crc = (crc >> 8) ^ crc64_table[0][(crc & 0xff) ^ *data];
+
   *(grub_uint64_t *) context = grub_cpu_to_le64 (~crc);
 }
 
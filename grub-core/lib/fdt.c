@@ -36,7 +36,7 @@
    the NULL-terminated string containing the name, plus padding if needed. */
 #define node_entry_size(node_name)	\
 	(2 * sizeof(grub_uint32_t)	\
-	+ ALIGN_UP (grub_strlen (name) + 1, sizeof(grub_uint32_t)))
+	+ ALIGN_UP (grub_strlen (node_name) + 1, sizeof(grub_uint32_t)))
 
 /* Size needed by a property entry: 1 token (FDT_PROPERTY), plus len and nameoff
    fields, plus the property value, plus padding if needed. */
@@ -356,6 +356,24 @@ int grub_fdt_add_subnode (void *fdt, unsigned int parentoffset,
   return add_subnode (fdt, parentoffset, name);
 }
 
+const void *grub_fdt_get_prop (const void *fdt, unsigned int nodeoffset,
+			       const char *name, grub_uint32_t *len)
+{
+  grub_uint32_t *prop;
+
+  if ((nodeoffset >= grub_fdt_get_size_dt_struct (fdt)) || (nodeoffset & 0x3)
+      || (grub_be_to_cpu32(*(grub_uint32_t *) ((grub_addr_t) fdt
+                           + grub_fdt_get_off_dt_struct (fdt) + nodeoffset))
+          != FDT_BEGIN_NODE))
+    return NULL;
+  prop = find_prop ((void *) fdt, nodeoffset, name);
+  if (!prop)
+    return NULL;
+  if (len)
+    *len = grub_be_to_cpu32 (*(prop + 1));
+  return prop + 3;
+}
+
 int grub_fdt_set_prop (void *fdt, unsigned int nodeoffset, const char *name,
 		       const void *val, grub_uint32_t len)
 {
@@ -460,3 +478,589 @@ grub_fdt_create_empty_tree (void *fdt, unsigned int size)
 
   return 0;
 }
+
+/* Editing sessions.
+
+   grub_fdt_set_prop and grub_fdt_add_subnode work on the flat blob: every
+   lookup walks the structure block and every edit that needs room moves
+   the blocks around, which gets quadratic when a loader makes several edits
+   to a large tree. A session instead parses the blob once into a tree of
+   nodes and properties, applies edits to that and writes the final blob
+   in one pass when committed. Values and names not touched by an edit keep
+   pointing into the source blob, so it must stay unchanged until the
+   session is committed.
+
+   Node handles are indices into the node array, the root node is 0.
+   Deleted nodes stay in the array, marked as such.  */
+
+#define FDT_EDIT_MAX_DEPTH	64
+
+struct fdt_edit_node
+{
+  const char *name;
+  int parent;
+  int first_child;
+  int last_child;
+  int next_sibling;
+  int first_prop;
+  int last_prop;
+  int deleted;
+};
+
+struct fdt_edit_prop
+{
+  const char *name;
+  grub_uint32_t nameoff;	/* offset in the output strings block */
+  const void *val;
+  grub_uint32_t len;
+  int next;
+};
+
+struct grub_fdt_edit
+{
+  const void *src;
+  struct fdt_edit_node *nodes;
+  unsigned int num_nodes;
+  unsigned int alloc_nodes;
+  struct fdt_edit_prop *props;
+  unsigned int num_props;
+  unsigned int alloc_props;
+  /* Names and values allocated for edits, freed with the session.  */
+  void **owned;
+  unsigned int num_owned;
+  unsigned int alloc_owned;
+  /* Names appended to the strings block, in order.  */
+  const char **new_strings;
+  unsigned int num_new_strings;
+  unsigned int alloc_new_strings;
+  grub_uint32_t size_dt_struct;
+  grub_uint32_t size_dt_strings;
+};
+
+/* Check that the string at S is terminated before END.  */
+static int
+edit_string_ok (const char *s, const char *end)
+{
+  while (s < end)
+    if (!*s++)
+      return 1;
+  return 0;
+}
+
+static int
+edit_grow (void **array, unsigned int *alloc, unsigned int num,
+	   grub_size_t elem_size)
+{
+  void *tmp;
+  unsigned int new_alloc;
+
+  if (num < *alloc)
+    return 0;
+  new_alloc = *alloc ? *alloc * 2 : 32;
+  tmp = grub_realloc (*array, new_alloc * elem_size);
+  if (!tmp)
+    return -1;
+  *array = tmp;
+  *alloc = new_alloc;
+  return 0;
+}
+
+static void *
+edit_own (grub_fdt_edit_t edit, const void *data, grub_size_t len)
+{
+  void *copy;
+
+  if (edit_grow ((void **) &edit->owned, &edit->alloc_owned, edit->num_owned,
+		 sizeof (edit->owned[0])) < 0)
+    return NULL;
+  copy = grub_malloc (len ? len : 1);
+  if (!copy)
+    return NULL;
+  grub_memcpy (copy, data, len);
+  edit->owned[edit->num_owned++] = copy;
+  return copy;
+}
+
+static int
+edit_new_node (grub_fdt_edit_t edit, int parent, const char *name)
+{
+  struct fdt_edit_node *node;
+  int index = edit->num_nodes;
+
+  if (edit_grow ((void **) &edit->nodes, &edit->alloc_nodes, edit->num_nodes,
+		 sizeof (edit->nodes[0])) < 0)
+    return -1;
+  node = &edit->nodes[edit->num_nodes++];
+  node->name = name;
+  node->parent = parent;
+  node->first_child = node->last_child = node->next_sibling = -1;
+  node->first_prop = node->last_prop = -1;
+  node->deleted = 0;
+
+  if (parent >= 0)
+    {
+      struct fdt_edit_node *p = &edit->nodes[parent];
+
+      if (p->last_child >= 0)
+	edit->nodes[p->last_child].next_sibling = index;
+      else
+	p->first_child = index;
+      p->last_child = index;
+    }
+  edit->size_dt_struct += node_entry_size (name);
+  return index;
+}
+
+static int
+edit_new_prop (grub_fdt_edit_t edit, int node, const char *name,
+	       grub_uint32_t nameoff, const void *val, grub_uint32_t len)
+{
+  struct fdt_edit_prop *prop;
+  struct fdt_edit_node *n = &edit->nodes[node];
+  int index = edit->num_props;
+
+  if (edit_grow ((void **) &edit->props, &edit->alloc_props, edit->num_props,
+		 sizeof (edit->props[0])) < 0)
+    return -1;
+  prop = &edit->props[edit->num_props++];
+  prop->name = name;
+  prop->nameoff = nameoff;
+  prop->val = val;
+  prop->len = len;
+  prop->next = -1;
+
+  if (n->last_prop >= 0)
+    edit->props[n->last_prop].next = index;
+  else
+    n->first_prop = index;
+  n->last_prop = index;
+  edit->size_dt_struct += prop_entry_size (len);
+  return index;
+}
+
+/* Build the node and property index of FDT in a single walk of its
+   structure block. FDT must have passed grub_fdt_check_header.  */
+grub_fdt_edit_t
+grub_fdt_edit_begin (const void *fdt)
+{
+  grub_fdt_edit_t edit;
+  const grub_uint32_t *token, *end;
+  const char *strings = (const char *) fdt + grub_fdt_get_off_dt_strings (fdt);
+  grub_uint32_t size_strings = grub_fdt_get_size_dt_strings (fdt);
+  int node = -1;
+  unsigned int depth = 0;
+
+  edit = grub_zalloc (sizeof (*edit));
+  if (!edit)
+    return NULL;
+  edit->src = fdt;
+  if (get_mem_rsvmap_size (fdt) < 0)
+    goto fail;
+  edit->size_dt_strings = size_strings;
+  /* FDT_END token.  */
+  edit->size_dt_struct = sizeof (grub_uint32_t);
+
+  token = (const void *) ((grub_addr_t) fdt + grub_fdt_get_off_dt_struct (fdt));
+  end = (const void *) struct_end (fdt);
+  while (token < end)
+    {
+      switch (grub_be_to_cpu32 (*token))
+	{
+	case FDT_BEGIN_NODE:
+	  {
+	    const char *name = (const char *) (token + 1);
+
+	    if ((node < 0 && edit->num_nodes) || depth >= FDT_EDIT_MAX_DEPTH
+		|| !edit_string_ok (name, (const char *) end))
+	      goto fail;
+	    node = edit_new_node (edit, node, name);
+	    if (node < 0)
+	      goto fail;
+	    depth++;
+	    token = (const void *) ALIGN_UP ((grub_addr_t) name
+					     + grub_strlen (name) + 1,
+					     sizeof (*token));
+	    break;
+	  }
+	case FDT_END_NODE:
+	  if (node < 0)
+	    goto fail;
+	  node = edit->nodes[node].parent;
+	  depth--;
+	  token++;
+	  break;
+	case FDT_PROP:
+	  {
+	    grub_uint32_t len, nameoff;
+
+	    if (node < 0 || token + 3 > end)
+	      goto fail;
+	    len = grub_be_to_cpu32 (*(token + 1));
+	    nameoff = grub_be_to_cpu32 (*(token + 2));
+	    if (len > (grub_addr_t) end - (grub_addr_t) (token + 3)
+		|| nameoff >= size_strings
+		|| !edit_string_ok (strings + nameoff, strings + size_strings))
+	      goto fail;
+	    if (edit_new_prop (edit, node, strings + nameoff, nameoff,
+			       token + 3, len) < 0)
+	      goto fail;
+	    token += prop_entry_size (len) / sizeof (*token);
+	    break;
+	  }
+	case FDT_NOP:
+	  token++;
+	  break;
+	case FDT_END:
+	  if (node >= 0 || !edit->num_nodes)
+	    goto fail;
+	  return edit;
+	default:
+	  goto fail;
+	}
+    }
+
+fail:
+  grub_fdt_edit_free (edit);
+  return NULL;
+}
+
+void
+grub_fdt_edit_free (grub_fdt_edit_t edit)
+{
+  unsigned int i;
+
+  if (!edit)
+    return;
+  for (i = 0; i < edit->num_owned; i++)
+    grub_free (edit->owned[i]);
+  grub_free (edit->owned);
+  grub_free (edit->new_strings);
+  grub_free (edit->props);
+  grub_free (edit->nodes);
+  grub_free (edit);
+}
+
+/* Whether NODE is the handle of a node still in the tree.  */
+static int
+edit_node_ok (grub_fdt_edit_t edit, int node)
+{
+  return (node >= 0 && (unsigned int) node < edit->num_nodes
+	  && !edit->nodes[node].deleted);
+}
+
+int
+grub_fdt_edit_find_subnode (grub_fdt_edit_t edit, int parent,
+			    const char *name)
+{
+  int child;
+
+  if (!edit_node_ok (edit, parent))
+    return -1;
+  for (child = edit->nodes[parent].first_child; child >= 0;
+       child = edit->nodes[child].next_sibling)
+    if (!grub_strcmp (edit->nodes[child].name, name))
+      return child;
+  return -1;
+}
+
+int
+grub_fdt_edit_add_subnode (grub_fdt_edit_t edit, int parent,
+			   const char *name)
+{
+  const char *copy;
+
+  if (!edit_node_ok (edit, parent))
+    return -1;
+  copy = edit_own (edit, name, grub_strlen (name) + 1);
+  if (!copy)
+    return -1;
+  return edit_new_node (edit, parent, copy);
+}
+
+/* Find NAME in the output strings block, appending it if it isn't there
+   yet. Returns a copy of NAME that lives as long as the session and sets
+   NAMEOFF to its offset.  */
+static const char *
+edit_string (grub_fdt_edit_t edit, const char *name, grub_uint32_t *nameoff)
+{
+  const char *strings = (const char *) edit->src
+			+ grub_fdt_get_off_dt_strings (edit->src);
+  grub_uint32_t size = grub_fdt_get_size_dt_strings (edit->src);
+  grub_uint32_t off, i;
+  const char *copy;
+
+  for (off = 0; off < size && edit_string_ok (strings + off, strings + size);
+       off += grub_strlen (strings + off) + 1)
+    if (!grub_strcmp (strings + off, name))
+      {
+	*nameoff = off;
+	return strings + off;
+      }
+  off = size;
+  for (i = 0; i < edit->num_new_strings; i++)
+    {
+      if (!grub_strcmp (edit->new_strings[i], name))
+	{
+	  *nameoff = off;
+	  return edit->new_strings[i];
+	}
+      off += grub_strlen (edit->new_strings[i]) + 1;
+    }
+
+  if (edit_grow ((void **) &edit->new_strings, &edit->alloc_new_strings,
+		 edit->num_new_strings, sizeof (edit->new_strings[0])) < 0)
+    return NULL;
+  copy = edit_own (edit, name, grub_strlen (name) + 1);
+  if (!copy)
+    return NULL;
+  edit->new_strings[edit->num_new_strings++] = copy;
+  edit->size_dt_strings += grub_strlen (name) + 1;
+  *nameoff = off;
+  return copy;
+}
+
+int
+grub_fdt_edit_set_prop (grub_fdt_edit_t edit, int node, const char *name,
+			const void *val, grub_uint32_t len)
+{
+  const void *copy;
+  grub_uint32_t nameoff;
+  int prop;
+
+  if (!edit_node_ok (edit, node))
+    return -1;
+
+  copy = edit_own (edit, val, len);
+  if (!copy)
+    return -1;
+
+  for (prop = edit->nodes[node].first_prop; prop >= 0;
+       prop = edit->props[prop].next)
+    if (!grub_strcmp (edit->props[prop].name, name))
+      {
+	edit->size_dt_struct += prop_entry_size (len)
+				- prop_entry_size (edit->props[prop].len);
+	edit->props[prop].val = copy;
+	edit->props[prop].len = len;
+	return 0;
+      }
+
+  name = edit_string (edit, name, &nameoff);
+  if (!name)
+    return -1;
+  return edit_new_prop (edit, node, name, nameoff, copy, len) < 0 ? -1 : 0;
+}
+
+int
+grub_fdt_edit_del_prop (grub_fdt_edit_t edit, int node, const char *name)
+{
+  struct fdt_edit_node *n;
+  int prop, prev = -1;
+
+  if (!edit_node_ok (edit, node))
+    return -1;
+
+  n = &edit->nodes[node];
+  for (prop = n->first_prop; prop >= 0; prev = prop,
+       prop = edit->props[prop].next)
+    if (!grub_strcmp (edit->props[prop].name, name))
+      {
+	if (prev >= 0)
+	  edit->props[prev].next = edit->props[prop].next;
+	else
+	  n->first_prop = edit->props[prop].next;
+	if (n->last_prop == prop)
+	  n->last_prop = prev;
+	edit->size_dt_struct -= prop_entry_size (edit->props[prop].len);
+	return 0;
+      }
+  return -1;
+}
+
+/* Delete NODE with all its properties and subnodes. The root node can't
+   be deleted.  */
+int
+grub_fdt_edit_del_node (grub_fdt_edit_t edit, int node)
+{
+  struct fdt_edit_node *parent;
+  int cur, prev = -1, prop;
+
+  if (!edit_node_ok (edit, node) || node == 0)
+    return -1;
+
+  parent = &edit->nodes[edit->nodes[node].parent];
+  for (cur = parent->first_child; cur != node;
+       cur = edit->nodes[cur].next_sibling)
+    prev = cur;
+  if (prev >= 0)
+    edit->nodes[prev].next_sibling = edit->nodes[node].next_sibling;
+  else
+    parent->first_child = edit->nodes[node].next_sibling;
+  if (parent->last_child == node)
+    parent->last_child = prev;
+
+  /* Mark the subtree deleted and take it out of the size, walking it the
+     way edit_write_node does.  */
+  cur = node;
+  while (1)
+    {
+      struct fdt_edit_node *n = &edit->nodes[cur];
+
+      n->deleted = 1;
+      edit->size_dt_struct -= node_entry_size (n->name);
+      for (prop = n->first_prop; prop >= 0; prop = edit->props[prop].next)
+	edit->size_dt_struct -= prop_entry_size (edit->props[prop].len);
+
+      if (n->first_child >= 0)
+	{
+	  cur = n->first_child;
+	  continue;
+	}
+      while (cur != node && edit->nodes[cur].next_sibling < 0)
+	cur = edit->nodes[cur].parent;
+      if (cur == node)
+	return 0;
+      cur = edit->nodes[cur].next_sibling;
+    }
+}
+
+/* Size of the blob the session would produce, without any free space.  */
+grub_uint32_t
+grub_fdt_edit_get_size (grub_fdt_edit_t edit)
+{
+  return (ALIGN_UP (sizeof (grub_fdt_header_t), 8)
+	  + get_mem_rsvmap_size (edit->src)
+	  + edit->size_dt_struct + edit->size_dt_strings);
+}
+
+static grub_uint32_t *
+edit_write_node (grub_fdt_edit_t edit, int index, grub_uint32_t *token)
+{
+  int prop, child, depth = 0;
+
+  /* Walk the tree depth first without recursion: write a node with its
+     properties, descend into its children and write the FDT_END_NODE once
+     the last one is done.  */
+  while (1)
+    {
+      const struct fdt_edit_node *node = &edit->nodes[index];
+      grub_size_t name_len = grub_strlen (node->name) + 1;
+
+      *token++ = grub_cpu_to_be32_compile_time (FDT_BEGIN_NODE);
+      token[ALIGN_UP (name_len, sizeof (*token)) / sizeof (*token) - 1] = 0;
+      grub_memcpy (token, node->name, name_len);
+      token += ALIGN_UP (name_len, sizeof (*token)) / sizeof (*token);
+
+      for (prop = node->first_prop; prop >= 0; prop = edit->props[prop].next)
+	{
+	  const struct fdt_edit_prop *p = &edit->props[prop];
+
+	  *token++ = grub_cpu_to_be32_compile_time (FDT_PROP);
+	  *token++ = grub_cpu_to_be32 (p->len);
+	  *token++ = grub_cpu_to_be32 (p->nameoff);
+	  if (p->len)
+	    {
+	      token[ALIGN_UP (p->len, sizeof (*token)) / sizeof (*token) - 1] = 0;
+	      grub_memcpy (token, p->val, p->len);
+	    }
+	  token += ALIGN_UP (p->len, sizeof (*token)) / sizeof (*token);
+	}
+
+      child = node->first_child;
+      if (child >= 0)
+	{
+	  index = child;
+	  depth++;
+	  continue;
+	}
+
+      /* Close nodes until one with a sibling left to write is found.  */
+      while (1)
+	{
+	  *token++ = grub_cpu_to_be32_compile_time (FDT_END_NODE);
+	  if (!depth)
+	    return token;
+	  if (edit->nodes[index].next_sibling >= 0)
+	    {
+	      index = edit->nodes[index].next_sibling;
+	      break;
+	    }
+	  index = edit->nodes[index].parent;
+	  depth--;
+	}
+    }
+}
+
+static void
+edit_write (grub_fdt_edit_t edit, grub_uint8_t *dest, grub_uint32_t size)
+{
+  const grub_uint8_t *src = edit->src;
+  grub_uint32_t off_mem_rsvmap = ALIGN_UP (sizeof (grub_fdt_header_t), 8);
+  grub_uint32_t off_dt_struct = off_mem_rsvmap + get_mem_rsvmap_size (src);
+  grub_uint32_t off_dt_strings = off_dt_struct + edit->size_dt_struct;
+  grub_uint32_t *token;
+  grub_uint8_t *strings;
+  unsigned int i;
+
+  grub_memset (dest, 0, off_mem_rsvmap);
+  grub_fdt_set_magic (dest, FDT_MAGIC);
+  grub_fdt_set_version (dest, FDT_SUPPORTED_VERSION);
+  grub_fdt_set_last_comp_version (dest, grub_fdt_get_last_comp_version (src));
+  grub_fdt_set_boot_cpuid_phys (dest, grub_fdt_get_boot_cpuid_phys (src));
+  grub_fdt_set_totalsize (dest, size);
+  grub_fdt_set_off_mem_rsvmap (dest, off_mem_rsvmap);
+  grub_fdt_set_off_dt_struct (dest, off_dt_struct);
+  grub_fdt_set_size_dt_struct (dest, edit->size_dt_struct);
+  grub_fdt_set_off_dt_strings (dest, off_dt_strings);
+  grub_fdt_set_size_dt_strings (dest, edit->size_dt_strings);
+
+  grub_memcpy (dest + off_mem_rsvmap, src + grub_fdt_get_off_mem_rsvmap (src),
+	       off_dt_struct - off_mem_rsvmap);
+
+  token = (grub_uint32_t *) (dest + off_dt_struct);
+  token = edit_write_node (edit, 0, token);
+  *token = grub_cpu_to_be32_compile_time (FDT_END);
+
+  strings = dest + off_dt_strings;
+  grub_memcpy (strings, src + grub_fdt_get_off_dt_strings (src),
+	       grub_fdt_get_size_dt_strings (src));
+  strings += grub_fdt_get_size_dt_strings (src);
+  for (i = 0; i < edit->num_new_strings; i++)
+    {
+      grub_size_t len = grub_strlen (edit->new_strings[i]) + 1;
+
+      grub_memcpy (strings, edit->new_strings[i], len);
+      strings += len;
+    }
+
+  grub_memset (strings, 0, dest + size - strings);
+}
+
+/* Write the edited tree to FDT, which has SIZE bytes of room; the space
+   not needed by the tree is left free at the end for later edits. FDT may
+   be the source blob of the session, in which case the tree is built in a
+   temporary buffer first.  */
+int
+grub_fdt_edit_commit (grub_fdt_edit_t edit, void *fdt, unsigned int size)
+{
+  const grub_uint8_t *src = edit->src;
+  grub_uint8_t *dest = fdt;
+  grub_uint8_t *tmp;
+
+  if (((grub_addr_t) fdt & 0x7) || size < grub_fdt_edit_get_size (edit))
+    return -1;
+
+  if (dest + size <= src || dest >= src + grub_fdt_get_totalsize (src))
+    {
+      edit_write (edit, dest, size);
+      return 0;
+    }
+
+  tmp = grub_malloc (size);
+  if (!tmp)
+    return -1;
+  edit_write (edit, tmp, size);
+  grub_memcpy (dest, tmp, size);
+  grub_free (tmp);
+  return 0;
+}
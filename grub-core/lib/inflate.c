@@ -0,0 +1,785 @@
+/* inflate.c - table driven deflate decoder */
+/*
+ *  GRUB  --  GRand Unified Bootloader
+ *  Copyright (C) 2024  Free Software Foundation, Inc.
+ *
+ *  GRUB is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  GRUB is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with GRUB.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/* The decoder keeps up to 63 input bits in a 64-bit buffer, which holds a
+   whole length/distance pair after one refill. Codes are resolved with a
+   single lookup in most cases; only codes longer than the first level
+   take a second one. Where two short literal codes fit in the first level
+   together they share one entry, so text-like data decodes two bytes per
+   lookup.  */
+
+#include <grub/types.h>
+#include <grub/err.h>
+#include <grub/misc.h>
+#include <grub/dl.h>
+#include <grub/inflate.h>
+
+GRUB_MOD_LICENSE ("GPLv3+");
+
+#define WSIZE		GRUB_INFLATE_WSIZE
+#define LITLEN_MASK	((1U << GRUB_INFLATE_LITLEN_BITS) - 1)
+#define DIST_MASK	((1U << GRUB_INFLATE_DIST_BITS) - 1)
+
+#define INFLATE_STORED	0
+#define INFLATE_FIXED	1
+#define INFLATE_DYNAMIC	2
+
+/* Table entries hold the value in bits 16-31, the number of extra bits
+   (or the size of a second level table, or the length of the first code
+   of a literal pair) in bits 8-15, the kind in bits 5-7 and the number of
+   bits to drop in bits 0-4.  */
+#define ENTRY_LITERAL	0
+#define ENTRY_LITERAL2	1
+#define ENTRY_BASE	2
+#define ENTRY_EOB	3
+#define ENTRY_SUBTABLE	4
+#define ENTRY_INVALID	5
+
+#define ENTRY(kind, extra, value) \
+  (((grub_uint32_t) (value) << 16) | ((extra) << 8) | ((kind) << 5))
+#define ENTRY_LEN(e)	((e) & 0x1f)
+#define ENTRY_KIND(e)	(((e) >> 5) & 7)
+#define ENTRY_EXTRA(e)	(((e) >> 8) & 0xff)
+#define ENTRY_VALUE(e)	((e) >> 16)
+
+enum
+  {
+    TABLE_CODELEN,
+    TABLE_LITLEN,
+    TABLE_DIST
+  };
+
+/* Order of the bit length code lengths.  */
+static const grub_uint8_t bitorder[] = {
+  16, 17, 18, 0, 8, 7, 9, 6, 10, 5, 11, 4, 12, 3, 13, 2, 14, 1, 15
+};
+
+/* Copy lengths and extra bits for literal codes 257..285.  */
+static const grub_uint16_t length_base[] = {
+  3, 4, 5, 6, 7, 8, 9, 10, 11, 13, 15, 17, 19, 23, 27, 31,
+  35, 43, 51, 59, 67, 83, 99, 115, 131, 163, 195, 227, 258
+};
+static const grub_uint8_t length_extra[] = {
+  0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, 1, 2, 2, 2, 2,
+  3, 3, 3, 3, 4, 4, 4, 4, 5, 5, 5, 5, 0
+};
+
+/* Copy offsets and extra bits for distance codes 0..29.  */
+static const grub_uint16_t dist_base[] = {
+  1, 2, 3, 4, 5, 7, 9, 13, 17, 25, 33, 49, 65, 97, 129, 193,
+  257, 385, 513, 769, 1025, 1537, 2049, 3073, 4097, 6145,
+  8193, 12289, 16385, 24577
+};
+static const grub_uint8_t dist_extra[] = {
+  0, 0, 0, 0, 1, 1, 2, 2, 3, 3, 4, 4, 5, 5, 6, 6,
+  7, 7, 8, 8, 9, 9, 10, 10, 11, 11, 12, 12, 13, 13
+};
+
+/* The tables for fixed Huffman codes, built on first use.  */
+static grub_uint32_t fixed_litlen[1 << GRUB_INFLATE_LITLEN_BITS];
+static grub_uint32_t fixed_dist[1 << GRUB_INFLATE_DIST_BITS];
+static int fixed_built;
+
+static grub_uint32_t
+symbol_entry (int type, unsigned sym)
+{
+  switch (type)
+    {
+    case TABLE_LITLEN:
+      if (sym < 256)
+	return ENTRY (ENTRY_LITERAL, 0, sym);
+      if (sym == 256)
+	return ENTRY (ENTRY_EOB, 0, 0);
+      sym -= 257;
+      if (sym < ARRAY_SIZE (length_base))
+	return ENTRY (ENTRY_BASE, length_extra[sym], length_base[sym]);
+      return ENTRY (ENTRY_INVALID, 0, 0);
+
+    case TABLE_DIST:
+      if (sym < ARRAY_SIZE (dist_base))
+	return ENTRY (ENTRY_BASE, dist_extra[sym], dist_base[sym]);
+      return ENTRY (ENTRY_INVALID, 0, 0);
+
+    default:
+      return ENTRY (ENTRY_LITERAL, 0, sym);
+    }
+}
+
+static unsigned
+reverse_bits (unsigned code, unsigned len)
+{
+  unsigned r = 0;
+
+  while (len--)
+    {
+      r = (r << 1) | (code & 1);
+      code >>= 1;
+    }
+  return r;
+}
+
+/* Build the decoding table for the code lengths LENS[0..N). The first
+   level is indexed by BITS input bits. Codes longer than that point to a
+   second level table sized for the longest code sharing their prefix. In
+   a complete code a second level table of 2^k entries comes with at least
+   k + 1 codes, so 288 literal/length codes never need more than 1024
+   entries beyond the first level and 30 distance codes no more than 512.
+   Only a code with a single symbol may be incomplete.  */
+static grub_err_t
+build_table (grub_uint32_t *table, unsigned size, unsigned bits,
+	     const grub_uint8_t *lens, unsigned n, int type)
+{
+  unsigned count[16], start[16], next[16];
+  grub_uint8_t sub_bits[1 << GRUB_INFLATE_LITLEN_BITS];
+  unsigned mask = (1U << bits) - 1;
+  unsigned sym, len, code, used, i;
+  int left;
+
+  grub_memset (count, 0, sizeof (count));
+  for (sym = 0; sym < n; sym++)
+    count[lens[sym]]++;
+  count[0] = 0;
+
+  left = 1;
+  used = 0;
+  for (len = 1; len < 16; len++)
+    {
+      left = 2 * left - count[len];
+      if (left < 0)
+	return grub_error (GRUB_ERR_BAD_COMPRESSED_DATA,
+			   "oversubscribed Huffman code");
+      used += count[len];
+    }
+  if (left > 0 && used > 1)
+    return grub_error (GRUB_ERR_BAD_COMPRESSED_DATA,
+		       "incomplete Huffman code");
+
+  code = 0;
+  for (len = 1; len < 16; len++)
+    {
+      code = (code + count[len - 1]) << 1;
+      start[len] = code;
+    }
+
+  for (i = 0; i <= mask; i++)
+    table[i] = ENTRY (ENTRY_INVALID, 0, 0);
+
+  /* Size the second level tables.  */
+  grub_memset (sub_bits, 0, mask + 1);
+  grub_memcpy (next, start, sizeof (next));
+  for (sym = 0; sym < n; sym++)
+    {
+      len = lens[sym];
+      if (len <= bits)
+	continue;
+      code = reverse_bits (next[len]++, len) & mask;
+      if (len - bits > sub_bits[code])
+	sub_bits[code] = len - bits;
+    }
+
+  used = mask + 1;
+  for (i = 0; i <= mask; i++)
+    if (sub_bits[i])
+      {
+	unsigned j;
+
+	if (used + (1U << sub_bits[i]) > size)
+	  return grub_error (GRUB_ERR_BAD_COMPRESSED_DATA,
+			     "Huffman table overflow");
+	table[i] = ENTRY (ENTRY_SUBTABLE, sub_bits[i], used) | bits;
+	for (j = 0; j < (1U << sub_bits[i]); j++)
+	  table[used + j] = ENTRY (ENTRY_INVALID, 0, 0);
+	used += 1U << sub_bits[i];
+      }
+
+  /* Fill in the codes, each one in all entries it's a prefix of.  */
+  grub_memcpy (next, start, sizeof (next));
+  for (sym = 0; sym < n; sym++)
+    {
+      grub_uint32_t e;
+
+      len = lens[sym];
+      if (!len)
+	continue;
+      code = reverse_bits (next[len]++, len);
+      e = symbol_entry (type, sym);
+
+      if (len <= bits)
+	for (i = code; i <= mask; i += 1U << len)
+	  table[i] = e | len;
+      else
+	{
+	  grub_uint32_t sub = table[code & mask];
+
+	  for (i = code >> bits; i < (1U << ENTRY_EXTRA (sub));
+	       i += 1U << (len - bits))
+	    table[ENTRY_VALUE (sub) + i] = e | (len - bits);
+	}
+    }
+
+  if (type != TABLE_LITLEN)
+    return GRUB_ERR_NONE;
+
+  /* Merge a literal with the one following it if both codes fit in the
+     index together. The second one is found at the index shifted by the
+     first code, which is lower, so going downwards it's still a plain
+     literal entry.  */
+  for (i = mask + 1; i-- > 0; )
+    {
+      grub_uint32_t e = table[i], e2;
+
+      if (ENTRY_KIND (e) != ENTRY_LITERAL)
+	continue;
+      len = ENTRY_LEN (e);
+      e2 = table[i >> len];
+      if (ENTRY_KIND (e2) != ENTRY_LITERAL || ENTRY_LEN (e2) > bits - len)
+	continue;
+      table[i] = (ENTRY (ENTRY_LITERAL2, len,
+			 ENTRY_VALUE (e) | (ENTRY_VALUE (e2) << 8))
+		  | (len + ENTRY_LEN (e2)));
+    }
+
+  return GRUB_ERR_NONE;
+}
+
+static grub_err_t
+build_fixed_tables (void)
+{
+  grub_uint8_t lens[288];
+  unsigned i;
+
+  for (i = 0; i < 144; i++)
+    lens[i] = 8;
+  for (; i < 256; i++)
+    lens[i] = 9;
+  for (; i < 280; i++)
+    lens[i] = 7;
+  for (; i < 288; i++)
+    lens[i] = 8;
+  if (build_table (fixed_litlen, ARRAY_SIZE (fixed_litlen),
+		   GRUB_INFLATE_LITLEN_BITS, lens, 288, TABLE_LITLEN))
+    return grub_errno;
+
+  /* Codes 30 and 31 are never used but make the code complete.  */
+  for (i = 0; i < 32; i++)
+    lens[i] = 5;
+  if (build_table (fixed_dist, ARRAY_SIZE (fixed_dist),
+		   GRUB_INFLATE_DIST_BITS, lens, 32, TABLE_DIST))
+    return grub_errno;
+
+  fixed_built = 1;
+  return GRUB_ERR_NONE;
+}
+
+/* Ask for more input once IN is used up. Returns zero at the end of it
+   or on a read error.  */
+static int
+fill_input (struct grub_inflate *inf)
+{
+  grub_ssize_t len;
+
+  if (inf->in_avail)
+    return 1;
+
+  len = inf->read ? inf->read (inf) : 0;
+  if (len <= 0)
+    return 0;
+
+  inf->in_avail = len;
+  return 1;
+}
+
+/* Fill the bit buffer to at least 56 bits one byte at a time, with zeros
+   once the input has ended.  */
+static void
+refill_slow (struct grub_inflate *inf)
+{
+  while (inf->nbits <= 55)
+    {
+      if (!fill_input (inf))
+	{
+	  inf->pad++;
+	  inf->nbits += 8;
+	  continue;
+	}
+      inf->bits |= (grub_uint64_t) *inf->in++ << inf->nbits;
+      inf->in_avail--;
+      inf->total_in++;
+      inf->nbits += 8;
+    }
+}
+
+static inline void
+drop_bits (struct grub_inflate *inf, unsigned n)
+{
+  inf->bits >>= n;
+  inf->nbits -= n;
+}
+
+/* Copy forwards in 8 byte steps. Safe for overlapping buffers as long as
+   SRC is above DEST or at least 8 bytes below it.  */
+static inline void
+copy_forward (grub_uint8_t *dest, const grub_uint8_t *src, unsigned n)
+{
+  while (n >= 8)
+    {
+      grub_set_unaligned64 (dest, grub_get_unaligned64 (src));
+      dest += 8;
+      src += 8;
+      n -= 8;
+    }
+  while (n--)
+    *dest++ = *src++;
+}
+
+/* Append LEN bytes from DIST back at DEST. The previous window is right
+   before the current one so the source never wraps, and up to 7 bytes
+   past the end may be overwritten.  */
+static inline void
+copy_match (grub_uint8_t *dest, unsigned dist, unsigned len)
+{
+  const grub_uint8_t *src = dest - dist;
+  grub_uint8_t *end = dest + len;
+
+  if (dist >= 8)
+    do
+      {
+	grub_set_unaligned64 (dest, grub_get_unaligned64 (src));
+	dest += 8;
+	src += 8;
+      }
+    while (dest < end);
+  else if (dist == 1)
+    {
+      grub_uint64_t v = src[0] * 0x0101010101010101ULL;
+
+      do
+	{
+	  grub_set_unaligned64 (dest, v);
+	  dest += 8;
+	}
+      while (dest < end);
+    }
+  else
+    /* Only the first DIST bytes of each store are right, the next store
+       starts behind them.  */
+    do
+      {
+	grub_set_unaligned64 (dest, grub_get_unaligned64 (src));
+	dest += dist;
+	src += dist;
+      }
+    while (dest < end);
+}
+
+static grub_err_t
+read_dynamic_header (struct grub_inflate *inf)
+{
+  grub_uint8_t cl[19], lens[286 + 30];
+  unsigned nl, nd, nb, n, i, j;
+
+  refill_slow (inf);
+  nl = 257 + (inf->bits & 0x1f);
+  drop_bits (inf, 5);
+  nd = 1 + (inf->bits & 0x1f);
+  drop_bits (inf, 5);
+  nb = 4 + (inf->bits & 0xf);
+  drop_bits (inf, 4);
+  if (nl > 286 || nd > 30)
+    return grub_error (GRUB_ERR_BAD_COMPRESSED_DATA, "too much data");
+
+  grub_memset (cl, 0, sizeof (cl));
+  for (j = 0; j < nb; j++)
+    {
+      if (inf->nbits < 3)
+	refill_slow (inf);
+      cl[bitorder[j]] = inf->bits & 7;
+      drop_bits (inf, 3);
+    }
+
+  /* The code length code only needs a 7 bit table, borrow the space of the
+     literal/length one.  */
+  if (build_table (inf->litlen, GRUB_INFLATE_LITLEN_ENOUGH, 7, cl, 19,
+		   TABLE_CODELEN))
+    return grub_errno;
+
+  n = nl + nd;
+  i = 0;
+  while (i < n)
+    {
+      grub_uint32_t e;
+      unsigned sym, rep;
+      grub_uint8_t val;
+
+      if (inf->nbits < 16)
+	refill_slow (inf);
+      e = inf->litlen[inf->bits & 0x7f];
+      if (ENTRY_KIND (e) == ENTRY_INVALID)
+	return grub_error (GRUB_ERR_BAD_COMPRESSED_DATA,
+			   "invalid code length code");
+      drop_bits (inf, ENTRY_LEN (e));
+      sym = ENTRY_VALUE (e);
+
+      if (sym < 16)
+	{
+	  lens[i++] = sym;
+	  continue;
+	}
+
+      if (sym == 16)
+	{
+	  if (i == 0)
+	    return grub_error (GRUB_ERR_BAD_COMPRESSED_DATA,
+			       "repeated length without a previous one");
+	  val = lens[i - 1];
+	  rep = 3 + (inf->bits & 3);
+	  drop_bits (inf, 2);
+	}
+      else if (sym == 17)
+	{
+	  val = 0;
+	  rep = 3 + (inf->bits & 7);
+	  drop_bits (inf, 3);
+	}
+      else
+	{
+	  val = 0;
+	  rep = 11 + (inf->bits & 0x7f);
+	  drop_bits (inf, 7);
+	}
+
+      if (i + rep > n)
+	return grub_error (GRUB_ERR_BAD_COMPRESSED_DATA,
+			   "too many codes found");
+      while (rep--)
+	lens[i++] = val;
+    }
+
+  if (!lens[256])
+    return grub_error (GRUB_ERR_BAD_COMPRESSED_DATA,
+		       "missing end-of-block code");
+
+  if (build_table (inf->litlen, GRUB_INFLATE_LITLEN_ENOUGH,
+		   GRUB_INFLATE_LITLEN_BITS, lens, nl, TABLE_LITLEN)
+      || build_table (inf->dist, GRUB_INFLATE_DIST_ENOUGH,
+		      GRUB_INFLATE_DIST_BITS, lens + nl, nd, TABLE_DIST))
+    return grub_errno;
+
+  inf->litlen_table = inf->litlen;
+  inf->dist_table = inf->dist;
+  inf->block_len = 1;
+  return GRUB_ERR_NONE;
+}
+
+grub_err_t
+grub_inflate_read_header (struct grub_inflate *inf)
+{
+  grub_uint32_t len;
+
+  inf->block_in = inf->total_in;
+  inf->block_bits = inf->bits;
+  inf->block_nbits = inf->nbits;
+
+  refill_slow (inf);
+  inf->last_block = inf->bits & 1;
+  inf->block_type = (inf->bits >> 1) & 3;
+  drop_bits (inf, 3);
+
+  switch (inf->block_type)
+    {
+    case INFLATE_STORED:
+      /* Go to the byte boundary and get the length and its complement.  */
+      drop_bits (inf, inf->nbits & 7);
+      refill_slow (inf);
+      len = inf->bits & 0xffff;
+      if (len != (~(inf->bits >> 16) & 0xffff))
+	return grub_error (GRUB_ERR_BAD_COMPRESSED_DATA,
+			   "the length of a stored block does not match");
+      drop_bits (inf, 32);
+      inf->block_len = len;
+      return GRUB_ERR_NONE;
+
+    case INFLATE_FIXED:
+      if (!fixed_built && build_fixed_tables ())
+	return grub_errno;
+      inf->litlen_table = fixed_litlen;
+      inf->dist_table = fixed_dist;
+      inf->block_len = 1;
+      return GRUB_ERR_NONE;
+
+    case INFLATE_DYNAMIC:
+      return read_dynamic_header (inf);
+
+    default:
+      return grub_error (GRUB_ERR_BAD_COMPRESSED_DATA,
+			 "unknown block type %d", inf->block_type);
+    }
+}
+
+/* Copy a stored block. The bit buffer is byte aligned here, drain it
+   first and then copy straight from the input.  */
+static grub_err_t
+copy_stored (struct grub_inflate *inf, unsigned *wp)
+{
+  unsigned w = *wp;
+
+  while (inf->block_len && w < 2 * WSIZE)
+    {
+      unsigned n;
+
+      if (inf->nbits)
+	{
+	  inf->buf[w++] = inf->bits;
+	  drop_bits (inf, 8);
+	  inf->block_len--;
+	  continue;
+	}
+
+      /* Nothing may be left above NBITS before reading the input
+	 directly.  */
+      inf->bits = 0;
+      if (!fill_input (inf))
+	{
+	  *wp = w;
+	  return grub_error (GRUB_ERR_BAD_COMPRESSED_DATA,
+			     "premature end of compressed data");
+	}
+
+      n = 2 * WSIZE - w;
+      if (n > inf->block_len)
+	n = inf->block_len;
+      if (n > inf->in_avail)
+	n = inf->in_avail;
+      copy_forward (inf->buf + w, inf->in, n);
+      w += n;
+      inf->in += n;
+      inf->in_avail -= n;
+      inf->total_in += n;
+      inf->block_len -= n;
+    }
+
+  *wp = w;
+  return GRUB_ERR_NONE;
+}
+
+/* Decode a Huffman coded block until its end or until the window is
+   full. The bit buffer is topped up to at least 48 bits, enough for a
+   length/distance pair with all extra bits, before each code. While at
+   least 8 input bytes are available this is a single unaligned load.  */
+static grub_err_t
+decode_codes (struct grub_inflate *inf, unsigned *wp)
+{
+  grub_uint8_t *win = inf->buf;
+  const grub_uint32_t *lt = inf->litlen_table;
+  const grub_uint32_t *dt = inf->dist_table;
+  const grub_uint8_t *in = inf->in;
+  grub_size_t in_avail = inf->in_avail;
+  grub_uint64_t bits = inf->bits;
+  unsigned nbits = inf->nbits;
+  unsigned w = *wp;
+  grub_err_t err = GRUB_ERR_NONE;
+
+  while (w < 2 * WSIZE)
+    {
+      grub_uint32_t e;
+      unsigned len, dist, n;
+
+      if (nbits < 48)
+	{
+	  if (in_avail >= 8)
+	    {
+	      bits |= grub_le_to_cpu64 (grub_get_unaligned64 (in)) << nbits;
+	      n = (63 - nbits) >> 3;
+	      in += n;
+	      in_avail -= n;
+	      nbits |= 56;
+	    }
+	  else
+	    {
+	      inf->total_in += in - inf->in;
+	      inf->in = in;
+	      inf->in_avail = in_avail;
+	      inf->bits = bits;
+	      inf->nbits = nbits;
+	      refill_slow (inf);
+	      in = inf->in;
+	      in_avail = inf->in_avail;
+	      bits = inf->bits;
+	      nbits = inf->nbits;
+	    }
+	}
+
+      e = lt[bits & LITLEN_MASK];
+      if (ENTRY_KIND (e) == ENTRY_SUBTABLE)
+	{
+	  bits >>= ENTRY_LEN (e);
+	  nbits -= ENTRY_LEN (e);
+	  e = lt[ENTRY_VALUE (e) + (bits & ((1U << ENTRY_EXTRA (e)) - 1))];
+	}
+
+      switch (ENTRY_KIND (e))
+	{
+	case ENTRY_LITERAL:
+	case ENTRY_LITERAL2:
+	  /* Run of literals, as long as the bit buffer holds the whole
+	     code and there's room for two bytes.  */
+	  while (w < 2 * WSIZE - 1)
+	    {
+	      win[w++] = ENTRY_VALUE (e);
+	      if (ENTRY_KIND (e) == ENTRY_LITERAL2)
+		win[w++] = ENTRY_VALUE (e) >> 8;
+	      bits >>= ENTRY_LEN (e);
+	      nbits -= ENTRY_LEN (e);
+	      e = lt[bits & LITLEN_MASK];
+	      if (ENTRY_KIND (e) > ENTRY_LITERAL2 || ENTRY_LEN (e) > nbits)
+		break;
+	    }
+	  if (w == 2 * WSIZE - 1 && ENTRY_KIND (e) <= ENTRY_LITERAL2
+	      && ENTRY_LEN (e) <= nbits)
+	    {
+	      /* Only the first of a pair fits.  */
+	      win[w++] = ENTRY_VALUE (e);
+	      n = (ENTRY_KIND (e) == ENTRY_LITERAL2) ? ENTRY_EXTRA (e)
+		: ENTRY_LEN (e);
+	      bits >>= n;
+	      nbits -= n;
+	    }
+	  continue;
+
+	case ENTRY_EOB:
+	  bits >>= ENTRY_LEN (e);
+	  nbits -= ENTRY_LEN (e);
+	  inf->block_len = 0;
+	  goto out;
+
+	case ENTRY_BASE:
+	  bits >>= ENTRY_LEN (e);
+	  nbits -= ENTRY_LEN (e);
+	  len = ENTRY_VALUE (e) + (bits & ((1U << ENTRY_EXTRA (e)) - 1));
+	  bits >>= ENTRY_EXTRA (e);
+	  nbits -= ENTRY_EXTRA (e);
+
+	  e = dt[bits & DIST_MASK];
+	  if (ENTRY_KIND (e) == ENTRY_SUBTABLE)
+	    {
+	      bits >>= ENTRY_LEN (e);
+	      nbits -= ENTRY_LEN (e);
+	      e = dt[ENTRY_VALUE (e) + (bits & ((1U << ENTRY_EXTRA (e)) - 1))];
+	    }
+	  if (ENTRY_KIND (e) != ENTRY_BASE)
+	    {
+	      err = grub_error (GRUB_ERR_BAD_COMPRESSED_DATA,
+				"invalid distance code");
+	      goto out;
+	    }
+	  bits >>= ENTRY_LEN (e);
+	  nbits -= ENTRY_LEN (e);
+	  dist = ENTRY_VALUE (e) + (bits & ((1U << ENTRY_EXTRA (e)) - 1));
+	  bits >>= ENTRY_EXTRA (e);
+	  nbits -= ENTRY_EXTRA (e);
+
+	  n = 2 * WSIZE - w;
+	  if (len > n)
+	    {
+	      inf->copy_len = len - n;
+	      inf->copy_dist = dist;
+	      len = n;
+	    }
+	  copy_match (win + w, dist, len);
+	  w += len;
+	  continue;
+
+	default:
+	  err = grub_error (GRUB_ERR_BAD_COMPRESSED_DATA,
+			    "an unused code found");
+	  goto out;
+	}
+    }
+
+ out:
+  inf->total_in += in - inf->in;
+  inf->in = in;
+  inf->in_avail = in_avail;
+  inf->bits = bits;
+  inf->nbits = nbits;
+  *wp = w;
+  return err;
+}
+
+void
+grub_inflate_init (struct grub_inflate *inf)
+{
+  inf->total_in = 0;
+  inf->bits = 0;
+  inf->nbits = 0;
+  inf->pad = 0;
+  inf->last_block = 0;
+  inf->block_len = 0;
+  inf->copy_len = 0;
+  inf->wp = 0;
+}
+
+grub_err_t
+grub_inflate_window (struct grub_inflate *inf)
+{
+  grub_err_t err = GRUB_ERR_NONE;
+  unsigned w = WSIZE;
+
+  /* The last window becomes the history of this one.  */
+  copy_forward (inf->buf, inf->buf + WSIZE, WSIZE);
+
+  while (w < 2 * WSIZE && err == GRUB_ERR_NONE)
+    {
+      if (inf->copy_len)
+	{
+	  unsigned n = 2 * WSIZE - w;
+
+	  if (n > inf->copy_len)
+	    n = inf->copy_len;
+	  copy_match (inf->buf + w, inf->copy_dist, n);
+	  w += n;
+	  inf->copy_len -= n;
+	  continue;
+	}
+
+      if (!inf->block_len)
+	{
+	  if (inf->last_block)
+	    break;
+	  err = grub_inflate_read_header (inf);
+	  continue;
+	}
+
+      if (inf->block_type == INFLATE_STORED)
+	err = copy_stored (inf, &w);
+      else
+	err = decode_codes (inf, &w);
+    }
+
+  inf->wp = w - WSIZE;
+
+  /* Any of the zeros added past the end of input used?  */
+  if (err == GRUB_ERR_NONE && inf->nbits < inf->pad * 8)
+    err = grub_error (GRUB_ERR_BAD_COMPRESSED_DATA,
+		      "premature end of compressed data");
+  if (err == GRUB_ERR_NONE)
+    err = grub_errno;
+
+  return err;
+}
@@ -0,0 +1,2 @@
+#include <grub/crypto.h>
+#include <cipher_wrap.h>
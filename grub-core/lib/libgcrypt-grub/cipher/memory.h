@@ -0,0 +1 @@
+#include <cipher_wrap.h>
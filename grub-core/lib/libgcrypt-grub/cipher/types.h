@@ -0,0 +1,2 @@
+#include <grub/types.h>
+#include <cipher_wrap.h>
@@ -0,0 +1 @@
+generic/mpi-asm-defs.h
\ No newline at end of file
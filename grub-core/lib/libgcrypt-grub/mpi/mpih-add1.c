@@ -0,0 +1 @@
+generic/mpih-add1.c
\ No newline at end of file
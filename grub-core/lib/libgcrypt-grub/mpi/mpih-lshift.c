@@ -0,0 +1 @@
+generic/mpih-lshift.c
\ No newline at end of file
@@ -0,0 +1 @@
+generic/mpih-mul1.c
\ No newline at end of file
@@ -0,0 +1 @@
+generic/mpih-mul2.c
\ No newline at end of file
@@ -0,0 +1 @@
+generic/mpih-mul3.c
\ No newline at end of file
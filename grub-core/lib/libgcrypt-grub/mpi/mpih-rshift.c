@@ -0,0 +1 @@
+generic/mpih-rshift.c
\ No newline at end of file
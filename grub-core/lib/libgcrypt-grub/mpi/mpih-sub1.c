@@ -0,0 +1 @@
+generic/mpih-sub1.c
\ No newline at end of file
@@ -0,0 +1 @@
+# include <grub/gcrypt/gcrypt.h>
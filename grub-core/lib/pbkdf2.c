@@ -25,6 +25,24 @@
 
 GRUB_MOD_LICENSE ("GPLv2+");
 
+/* HMAC of DATA. INNER and OUTER are contexts which have already hashed
+   the inner and outer padded key, CTX is scratch space.  */
+static void
+hmac_from_pads (const struct gcry_md_spec *md, const void *inner,
+		const void *outer, void *ctx, const void *data,
+		grub_size_t size, grub_uint8_t *out)
+{
+  grub_memcpy (ctx, inner, md->contextsize);
+  md->write (ctx, data, size);
+  md->final (ctx);
+  grub_memcpy (out, md->read (ctx), md->mdlen);
+
+  grub_memcpy (ctx, outer, md->contextsize);
+  md->write (ctx, out, md->mdlen);
+  md->final (ctx);
+  grub_memcpy (out, md->read (ctx), md->mdlen);
+}
+
 /* Implement PKCS#5 PBKDF2 as per RFC 2898.  The PRF to use is HMAC variant
    of digest supplied by MD.  Inputs are the password P of length PLEN,
    the salt S of length SLEN, the iteration counter C (> 0), and the
@@ -48,13 +66,17 @@ grub_crypto_pbkdf2 (const struct gcry_md_spec *md,
   unsigned int r;
   unsigned int i;
   unsigned int k;
-  gcry_err_code_t rc;
   grub_uint8_t *tmp;
   grub_size_t tmplen = Slen + 4;
+  grub_uint8_t *inner, *outer, *ctx, *pad;
+  grub_size_t worklen;
 
   if (md->mdlen > GRUB_CRYPTO_MAX_MDLEN || md->mdlen == 0)
     return GPG_ERR_INV_ARG;
 
+  if (md->mdlen > md->blocksize)
+    return GPG_ERR_INV_ARG;
+
   if (c == 0)
     return GPG_ERR_INV_ARG;
 
@@ -71,6 +93,42 @@ grub_crypto_pbkdf2 (const struct gcry_md_spec *md,
   if (tmp == NULL)
     return GPG_ERR_OUT_OF_MEMORY;
 
+  /* Every HMAC starts by hashing a block derived from the key, one for the
+     inner and one for the outer hash. Hash them once and start each of
+     the C * L HMACs from copies of the resulting contexts.  */
+  worklen = 3 * md->contextsize + md->blocksize;
+  inner = grub_malloc (worklen);
+  if (inner == NULL)
+    {
+      grub_free (tmp);
+      return GPG_ERR_OUT_OF_MEMORY;
+    }
+  outer = inner + md->contextsize;
+  ctx = outer + md->contextsize;
+  pad = ctx + md->contextsize;
+
+  if (Plen > md->blocksize)
+    {
+      md->init (ctx);
+      md->write (ctx, P, Plen);
+      md->final (ctx);
+      grub_memcpy (U, md->read (ctx), hLen);
+      P = U;
+      Plen = hLen;
+    }
+
+  grub_memset (pad, 0x36, md->blocksize);
+  for (k = 0; k < Plen; k++)
+    pad[k] ^= P[k];
+  md->init (inner);
+  md->write (inner, pad, md->blocksize);
+
+  grub_memset (pad, 0x5c, md->blocksize);
+  for (k = 0; k < Plen; k++)
+    pad[k] ^= P[k];
+  md->init (outer);
+  md->write (outer, pad, md->blocksize);
+
   grub_memcpy (tmp, S, Slen);
 
   for (i = 1; i - 1 < l; i++)
@@ -86,16 +144,10 @@ grub_crypto_pbkdf2 (const struct gcry_md_spec *md,
 	      tmp[Slen + 2] = (i & 0x0000ff00) >> 8;
 	      tmp[Slen + 3] = (i & 0x000000ff) >> 0;
 
-	      rc = grub_crypto_hmac_buffer (md, P, Plen, tmp, tmplen, U);
+	      hmac_from_pads (md, inner, outer, ctx, tmp, tmplen, U);
 	    }
 	  else
-	    rc = grub_crypto_hmac_buffer (md, P, Plen, U, hLen, U);
-
-	  if (rc != GPG_ERR_NO_ERROR)
-	    {
-	      grub_free (tmp);
-	      return rc;
-	    }
+	    hmac_from_pads (md, inner, outer, ctx, U, hLen, U);
 
 	  for (k = 0; k < hLen; k++)
 	    T[k] ^= U[k];
@@ -104,6 +156,10 @@ grub_crypto_pbkdf2 (const struct gcry_md_spec *md,
       grub_memcpy (DK + (i - 1) * hLen, T, i == l ? r : hLen);
     }
 
+  grub_memset (inner, 0, worklen);
+  grub_memset (U, 0, sizeof (U));
+  grub_memset (T, 0, sizeof (T));
+  grub_free (inner);
   grub_free (tmp);
 
   return GPG_ERR_NO_ERROR;
@@ -0,0 +1,285 @@
+/*
+ *  GRUB  --  GRand Unified Bootloader
+ *  Copyright (C) 2024  Free Software Foundation, Inc.
+ *
+ *  GRUB is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  GRUB is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with GRUB.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/* SHA-1, SHA-224 and SHA-256 using the SHA instructions of x86_64 and
+   arm64, registered over the specs of gcry_sha1 and gcry_sha256 the same
+   way aes_hw does for AES. The block functions are in assembly, this file
+   does the buffering and padding.  */
+
+#include <grub/types.h>
+#include <grub/misc.h>
+#include <grub/crypto.h>
+#include <grub/dl.h>
+#ifdef __x86_64__
+#include <grub/i386/cpuid.h>
+#endif
+
+GRUB_MOD_LICENSE ("GPLv3+");
+
+#define SHA_BLOCK_SIZE	64
+
+struct sha_hw_context
+{
+  grub_uint32_t h[8];
+  grub_uint64_t nbytes;
+  /* Partial input block, and the digest after final.  */
+  grub_uint8_t buf[SHA_BLOCK_SIZE];
+  unsigned count;
+};
+
+typedef void (*sha_hw_blocks_t) (grub_uint32_t *state, const void *data,
+				 grub_size_t blocks);
+
+void grub_sha1_hw_blocks (grub_uint32_t *state, const void *data,
+			  grub_size_t blocks);
+void grub_sha256_hw_blocks (grub_uint32_t *state, const void *data,
+			    grub_size_t blocks);
+
+
+#ifdef __x86_64__
+
+static void
+sha_hw_supported (int *sha1, int *sha256)
+{
+  grub_uint32_t eax, ebx, ecx, edx;
+
+  *sha1 = *sha256 = 0;
+
+  if (!grub_cpu_is_cpuid_supported ())
+    return;
+
+  grub_cpuid (0, eax, ebx, ecx, edx);
+  if (eax < 7)
+    return;
+
+  /* SSSE3 and SSE4.1 are used alongside the SHA instructions.  */
+  grub_cpuid (1, eax, ebx, ecx, edx);
+  if (!(ecx & (1 << 9)) || !(ecx & (1 << 19)))
+    return;
+
+  /* Leaf 7 needs the subleaf in ECX, which grub_cpuid doesn't set.  */
+  asm volatile ("cpuid"
+		: "=a" (eax), "=b" (ebx), "=c" (ecx), "=d" (edx)
+		: "0" (7), "2" (0));
+  *sha1 = *sha256 = !!(ebx & (1 << 29));
+}
+
+#elif defined (__aarch64__)
+
+#define ID_AA64ISAR0_SHA1_SHIFT	8
+#define ID_AA64ISAR0_SHA2_SHIFT	12
+#define ID_AA64ISAR0_FIELD_MASK	0xf
+
+static void
+sha_hw_supported (int *sha1, int *sha256)
+{
+  grub_uint64_t isar0;
+
+  asm volatile ("mrs %0, id_aa64isar0_el1" : "=r" (isar0));
+  *sha1 = ((isar0 >> ID_AA64ISAR0_SHA1_SHIFT)
+	   & ID_AA64ISAR0_FIELD_MASK) != 0;
+  *sha256 = ((isar0 >> ID_AA64ISAR0_SHA2_SHIFT)
+	     & ID_AA64ISAR0_FIELD_MASK) != 0;
+}
+
+#else
+#error "No SHA instructions for this CPU"
+#endif
+
+static void
+sha_hw_write (struct sha_hw_context *ctx, const grub_uint8_t *in,
+	      grub_size_t size, sha_hw_blocks_t blocks)
+{
+  ctx->nbytes += size;
+
+  if (ctx->count)
+    {
+      unsigned n = SHA_BLOCK_SIZE - ctx->count;
+
+      if (n > size)
+	n = size;
+      grub_memcpy (ctx->buf + ctx->count, in, n);
+      ctx->count += n;
+      in += n;
+      size -= n;
+      if (ctx->count < SHA_BLOCK_SIZE)
+	return;
+      blocks (ctx->h, ctx->buf, 1);
+      ctx->count = 0;
+    }
+
+  if (size >= SHA_BLOCK_SIZE)
+    {
+      blocks (ctx->h, in, size / SHA_BLOCK_SIZE);
+      in += size & ~(SHA_BLOCK_SIZE - 1);
+      size &= SHA_BLOCK_SIZE - 1;
+    }
+
+  grub_memcpy (ctx->buf, in, size);
+  ctx->count = size;
+}
+
+/* Pad, and leave the big endian digest of NWORDS words in BUF.  */
+static void
+sha_hw_final (struct sha_hw_context *ctx, sha_hw_blocks_t blocks,
+	      unsigned nwords)
+{
+  grub_uint64_t bits = grub_cpu_to_be64 (ctx->nbytes << 3);
+  unsigned i;
+
+  ctx->buf[ctx->count++] = 0x80;
+  if (ctx->count > SHA_BLOCK_SIZE - 8)
+    {
+      grub_memset (ctx->buf + ctx->count, 0, SHA_BLOCK_SIZE - ctx->count);
+      blocks (ctx->h, ctx->buf, 1);
+      ctx->count = 0;
+    }
+  grub_memset (ctx->buf + ctx->count, 0, SHA_BLOCK_SIZE - 8 - ctx->count);
+  grub_memcpy (ctx->buf + SHA_BLOCK_SIZE - 8, &bits, 8);
+  blocks (ctx->h, ctx->buf, 1);
+
+  for (i = 0; i < nwords; i++)
+    grub_set_unaligned32 (ctx->buf + 4 * i, grub_cpu_to_be32 (ctx->h[i]));
+}
+
+static unsigned char *
+sha_hw_read (void *context)
+{
+  struct sha_hw_context *ctx = context;
+
+  return ctx->buf;
+}
+
+static void
+sha1_hw_init (void *context)
+{
+  struct sha_hw_context *ctx = context;
+
+  ctx->h[0] = 0x67452301;
+  ctx->h[1] = 0xefcdab89;
+  ctx->h[2] = 0x98badcfe;
+  ctx->h[3] = 0x10325476;
+  ctx->h[4] = 0xc3d2e1f0;
+  ctx->nbytes = 0;
+  ctx->count = 0;
+}
+
+static void
+sha1_hw_write (void *context, const void *buf, grub_size_t size)
+{
+  sha_hw_write (context, buf, size, grub_sha1_hw_blocks);
+}
+
+static void
+sha1_hw_final (void *context)
+{
+  sha_hw_final (context, grub_sha1_hw_blocks, 5);
+}
+
+static void
+sha224_hw_init (void *context)
+{
+  struct sha_hw_context *ctx = context;
+
+  ctx->h[0] = 0xc1059ed8;
+  ctx->h[1] = 0x367cd507;
+  ctx->h[2] = 0x3070dd17;
+  ctx->h[3] = 0xf70e5939;
+  ctx->h[4] = 0xffc00b31;
+  ctx->h[5] = 0x68581511;
+  ctx->h[6] = 0x64f98fa7;
+  ctx->h[7] = 0xbefa4fa4;
+  ctx->nbytes = 0;
+  ctx->count = 0;
+}
+
+static void
+sha256_hw_init (void *context)
+{
+  struct sha_hw_context *ctx = context;
+
+  ctx->h[0] = 0x6a09e667;
+  ctx->h[1] = 0xbb67ae85;
+  ctx->h[2] = 0x3c6ef372;
+  ctx->h[3] = 0xa54ff53a;
+  ctx->h[4] = 0x510e527f;
+  ctx->h[5] = 0x9b05688c;
+  ctx->h[6] = 0x1f83d9ab;
+  ctx->h[7] = 0x5be0cd19;
+  ctx->nbytes = 0;
+  ctx->count = 0;
+}
+
+static void
+sha256_hw_write (void *context, const void *buf, grub_size_t size)
+{
+  sha_hw_write (context, buf, size, grub_sha256_hw_blocks);
+}
+
+static void
+sha224_hw_final (void *context)
+{
+  sha_hw_final (context, grub_sha256_hw_blocks, 7);
+}
+
+static void
+sha256_hw_final (void *context)
+{
+  sha_hw_final (context, grub_sha256_hw_blocks, 8);
+}
+
+static gcry_md_spec_t sha1_hw_spec, sha224_hw_spec, sha256_hw_spec;
+
+static void
+sha_hw_register (gcry_md_spec_t *spec, const gcry_md_spec_t *portable,
+		 gcry_md_init_t init, gcry_md_write_t write,
+		 gcry_md_final_t final)
+{
+  *spec = *portable;
+  spec->init = init;
+  spec->write = write;
+  spec->final = final;
+  spec->read = sha_hw_read;
+  spec->contextsize = sizeof (struct sha_hw_context);
+  grub_md_register (spec);
+}
+
+GRUB_MOD_INIT(sha_hw)
+{
+  int sha1, sha256;
+
+  sha_hw_supported (&sha1, &sha256);
+
+  if (sha1)
+    sha_hw_register (&sha1_hw_spec, GRUB_MD_SHA1, sha1_hw_init,
+		     sha1_hw_write, sha1_hw_final);
+  if (sha256)
+    {
+      sha_hw_register (&sha224_hw_spec, GRUB_MD_SHA224,
+		       sha224_hw_init, sha256_hw_write, sha224_hw_final);
+      sha_hw_register (&sha256_hw_spec, GRUB_MD_SHA256, sha256_hw_init,
+		       sha256_hw_write, sha256_hw_final);
+    }
+}
+
+GRUB_MOD_FINI(sha_hw)
+{
+  grub_md_unregister (&sha1_hw_spec);
+  grub_md_unregister (&sha224_hw_spec);
+  grub_md_unregister (&sha256_hw_spec);
+}
@@ -18,7 +18,9 @@
  */
 
 #include <grub/dl.h>
+#include <grub/fdt.h>
 #include <grub/file.h>
+#include <grub/fs.h>
 #include <grub/loader.h>
 #include <grub/mm.h>
 #include <grub/misc.h>
@@ -31,6 +33,7 @@
 #include <grub/lib/cpio.h>
 #include <grub/lib/cmdline.h>
 #include <grub/env.h>
+#include <grub/time.h>
 
 GRUB_MOD_LICENSE ("GPLv3+");
 
@@ -48,8 +51,6 @@ typedef void (*kernel_entry_t) (int, unsigned long, void *);
 #define MIN(a, b) (((a) < (b)) ? (a) : (b))
 
 static grub_efi_guid_t global = GRUB_EFI_GLOBAL_VARIABLE_GUID;
-static const char *cpio_name_mbinit = "/init.multiboot";
-static const char *cpio_name_grubrd = "/grub_ramdisk";
 
 static grub_dl_t my_mod;
 static char *linux_args;
@@ -57,8 +58,25 @@ static char *linux_args;
 static struct boot_info
 {
   boot_img_hdr *hdr;
+  grub_uint32_t dtb_addr;	/* device tree, 0 to boot with ATAGS */
+  grub_uint32_t dtb_size;
 } bootinfo;
 
+union android_hdr
+{
+  boot_img_hdr v0;
+  boot_img_hdr_v1 v1;
+  boot_img_hdr_v2 v2;
+  boot_img_hdr_v3 v3;
+  boot_img_hdr_v4 v4;
+};
+
+union vendor_hdr
+{
+  vendor_boot_img_hdr_v3 v3;
+  vendor_boot_img_hdr_v4 v4;
+};
+
 /*
  * SOURCE ABSTRACTION
  */
@@ -223,6 +241,115 @@ err_out:
   return grub_errno;
 }
 
+static struct multiboot_file
+{
+  const char *name;		/* name inside the ramdisk */
+  void *data;
+  grub_size_t size;
+} mbfiles[] =
+{
+  {"/init.multiboot", NULL, 0},
+  {"/grub_ramdisk", NULL, 0},
+};
+
+static void
+android_free_multiboot_files (void)
+{
+  unsigned i;
+
+  for (i = 0; i < ARRAY_SIZE (mbfiles); i++)
+    {
+      grub_free (mbfiles[i].data);
+      mbfiles[i].data = NULL;
+      mbfiles[i].size = 0;
+    }
+}
+
+static grub_err_t
+android_load_multiboot_files (void)
+{
+  // load mbinit
+  if (android_read_grub_file ("multiboot/sbin/init", &mbfiles[0].data,
+			      &mbfiles[0].size))
+    goto err_free;
+
+  // load grub ramdisk (if available)
+  if (android_read_grub_disk (&mbfiles[1].data, &mbfiles[1].size))
+    goto err_free;
+
+  return GRUB_ERR_NONE;
+
+err_free:
+  android_free_multiboot_files ();
+  return grub_errno;
+}
+
+// number of bytes the multiboot files add to a ramdisk, including the
+// trailer and the padding needed to start a new archive
+static grub_size_t
+android_multiboot_files_size (void)
+{
+  grub_size_t size = cpio_predict_obj_size (sizeof (CPIO_TRAILER), 0) + 3;
+  unsigned i;
+
+  for (i = 0; i < ARRAY_SIZE (mbfiles); i++)
+    if (mbfiles[i].data && mbfiles[i].size)
+      size += cpio_predict_obj_size (grub_strlen (mbfiles[i].name) + 1,
+				     mbfiles[i].size);
+
+  return size;
+}
+
+static cpio_newc_header_t *
+android_append_multiboot_files (cpio_newc_header_t * cpiohd)
+{
+  unsigned i;
+
+  for (i = 0; i < ARRAY_SIZE (mbfiles); i++)
+    if (mbfiles[i].data && mbfiles[i].size)
+      cpiohd = cpio_create_obj (cpiohd, mbfiles[i].name, mbfiles[i].data,
+				mbfiles[i].size);
+
+  return cpio_create_obj (cpiohd, CPIO_TRAILER, NULL, 0);
+}
+
+#define CPIO_TRAILER_SCAN_SIZE 0x10000
+
+// Append the multiboot files to the ramdisk where it was loaded. The caller
+// must have reserved android_multiboot_files_size () bytes of headroom
+// behind it. If the ramdisk ends with an uncompressed archive, its trailer
+// gets replaced; otherwise (compressed ramdisks, vendor fragments) a new
+// archive is started, the kernel unpacks concatenated archives in order.
+static grub_err_t
+android_append_ramdisk (boot_img_hdr * hdr, grub_size_t headroom)
+{
+  char *start = (char *) hdr->ramdisk_addr;
+  grub_size_t skip = 0;
+  cpio_newc_header_t *cpiohd;
+
+  // the trailer is followed by padding at most, so only look at the end
+  if (hdr->ramdisk_size > CPIO_TRAILER_SCAN_SIZE)
+    skip = (hdr->ramdisk_size - CPIO_TRAILER_SCAN_SIZE) & ~3;
+
+  cpiohd = cpio_find_trailer (start + skip, hdr->ramdisk_size - skip);
+  if (!cpiohd)
+    cpiohd = (cpio_newc_header_t *) (start + ALIGN (hdr->ramdisk_size, 4));
+
+  if ((char *) cpiohd - start + android_multiboot_files_size ()
+      > hdr->ramdisk_size + headroom)
+    return grub_error (GRUB_ERR_BUG, N_("Ramdisk headroom too small"));
+
+  // write our files and a new trailer
+  cpiohd = android_append_multiboot_files (cpiohd);
+
+  // set new ramdisk size
+  hdr->ramdisk_size = (char *) cpiohd - start;
+
+  return GRUB_ERR_NONE;
+}
+
+// Copy the (possibly compressed) ramdisk to a new location behind all
+// other images and append the multiboot files there.
 static grub_err_t
 android_patch_ramdisk (boot_img_hdr * hdr)
 {
@@ -255,26 +382,8 @@ android_patch_ramdisk (boot_img_hdr * hdr)
       goto err_free_buffer;
     }
 
-  // load mbinit
-  void *mbinit = NULL;
-  grub_size_t mbinit_size = 0;
-  if (android_read_grub_file ("multiboot/sbin/init", &mbinit, &mbinit_size))
-    goto err_free_buffer;
-
-  // load grub ramdisk (if available)
-  void *grubrd = NULL;
-  grub_size_t grubrd_size = 0;
-  if (android_read_grub_disk (&grubrd, &grubrd_size))
-    goto err_free_mbinit;
-
   // calculate new size
-  grub_uint32_t newsize = cpiosize;
-  if (mbinit && mbinit_size)
-    newsize +=
-      cpio_predict_obj_size (grub_strlen (cpio_name_mbinit), mbinit_size);
-  if (grubrd && grubrd_size)
-    newsize +=
-      cpio_predict_obj_size (grub_strlen (cpio_name_grubrd), grubrd_size);
+  grub_uint32_t newsize = cpiosize + android_multiboot_files_size ();
 
   // get highest address in use by bootimg images
   grub_uint32_t addr_max = (hdr->kernel_addr + hdr->kernel_size);
@@ -293,7 +402,7 @@ android_patch_ramdisk (boot_img_hdr * hdr)
     (grub_uint32_t) grub_efi_allocate_loader_memory (addr_max - addr_min,
 						     newsize + 4096);
   if (!hdr->ramdisk_addr)
-    goto err_free_grubrd;
+    goto err_free_buffer;
 
   // align memory to page size
   hdr->ramdisk_addr = ALIGN (hdr->ramdisk_addr, 4096);
@@ -301,7 +410,7 @@ android_patch_ramdisk (boot_img_hdr * hdr)
     {
       grub_error (GRUB_ERR_BAD_OS, N_("Invalid ramdisk address 0x%x\n"),
 		  hdr->ramdisk_addr);
-      goto err_free_grubrd;
+      goto err_free_buffer;
     }
 
   // copy old ramdisk to the new location
@@ -310,30 +419,17 @@ android_patch_ramdisk (boot_img_hdr * hdr)
   // add our files to the ramdisk
   cpio_newc_header_t *cpiohd = (void *) hdr->ramdisk_addr;
   cpiohd = cpio_get_last (cpiohd);
-
-  if (mbinit && mbinit_size)
-    cpiohd = cpio_create_obj (cpiohd, cpio_name_mbinit, mbinit, mbinit_size);
-  if (grubrd && grubrd_size)
-    cpiohd = cpio_create_obj (cpiohd, cpio_name_grubrd, grubrd, grubrd_size);
-  cpiohd = cpio_create_obj (cpiohd, CPIO_TRAILER, NULL, 0);
+  cpiohd = android_append_multiboot_files (cpiohd);
 
   // set new ramdisk size
   hdr->ramdisk_size = ((grub_uint32_t) cpiohd) - hdr->ramdisk_addr;
 
   // cleanup
-  if (grubrd && grubrd_size)
-    grub_free (grubrd);
-  grub_free (mbinit);
   grub_free (cpiobuf);
   grub_file_close (cpiofile);
 
   return GRUB_ERR_NONE;
 
-err_free_grubrd:
-  if (grubrd && grubrd_size)
-    grub_free (grubrd);
-err_free_mbinit:
-  grub_free (mbinit);
 err_free_buffer:
   grub_free (cpiobuf);
 err_close_cpiofile:
@@ -342,6 +438,624 @@ err_out:
   return grub_errno;
 }
 
+/*
+ * SECTION LOADING
+ */
+
+// memory regions the sections get placed in
+enum
+{
+  REGION_KERNEL,
+  REGION_RAMDISK,
+  REGION_SECOND,
+  REGION_DTB,
+  REGION_COUNT
+};
+
+// sections which are not needed for the selected boot mode
+#define REGION_NONE REGION_COUNT
+
+#define MAX_SECTIONS 24
+
+// compressed sections are decompressed this much at a time
+#define DECOMPRESS_CHUNK (8 << 20)
+
+static struct android_region
+{
+  const char *name;
+  grub_uint32_t *addr;		/* load address */
+  grub_uint32_t size;		/* bytes filled by sections */
+  grub_uint32_t headroom;	/* extra bytes allocated behind the data */
+  grub_efi_uintn_t pages;	/* pages allocated at *addr */
+} regions[REGION_COUNT];
+
+static struct android_section
+{
+  const char *name;
+  struct source *src;
+  grub_off_t offset;		/* offset in the image */
+  grub_uint32_t size;		/* size in bytes */
+  grub_uint32_t load_size;	/* size once loaded, after decompression */
+  grub_file_t file;		/* decompressor, NULL if stored plain */
+  unsigned region;		/* region it's placed in */
+  grub_uint32_t region_offset;	/* offset inside that region */
+  grub_uint32_t pad;		/* zero bytes in front of it */
+  grub_uint64_t time_ms;	/* time spent reading */
+} sections[MAX_SECTIONS];
+
+static unsigned num_sections;
+
+static void
+android_init_sections (boot_img_hdr * hdr)
+{
+  unsigned i;
+
+  regions[REGION_KERNEL].name = "kernel";
+  regions[REGION_KERNEL].addr = &hdr->kernel_addr;
+
+  regions[REGION_RAMDISK].name = "ramdisk";
+  regions[REGION_RAMDISK].addr = &hdr->ramdisk_addr;
+
+  regions[REGION_SECOND].name = "second";
+  regions[REGION_SECOND].addr = &hdr->second_addr;
+
+  regions[REGION_DTB].name = "dtb";
+  regions[REGION_DTB].addr = &bootinfo.dtb_addr;
+
+  for (i = 0; i < REGION_COUNT; i++)
+    {
+      regions[i].size = 0;
+      regions[i].headroom = 0;
+      regions[i].pages = 0;
+    }
+
+  num_sections = 0;
+}
+
+static grub_err_t
+android_add_section (const char *name, struct source *src, grub_off_t offset,
+		     grub_uint32_t size, unsigned region)
+{
+  struct android_section *sec;
+
+  if (!size)
+    return GRUB_ERR_NONE;
+
+  if (num_sections == MAX_SECTIONS)
+    return grub_error (GRUB_ERR_BAD_OS, N_("too many sections"));
+
+  sec = &sections[num_sections++];
+  sec->name = name;
+  sec->src = src;
+  sec->offset = offset;
+  sec->size = size;
+  sec->load_size = size;
+  sec->file = NULL;
+  sec->region = region;
+  sec->region_offset = 0;
+  sec->pad = 0;
+  sec->time_ms = 0;
+
+  return GRUB_ERR_NONE;
+}
+
+static grub_err_t
+android_check_page_size (grub_uint32_t page_size)
+{
+  if (!page_size || (page_size & (page_size - 1)))
+    return grub_error (GRUB_ERR_BAD_OS, N_("invalid page size %u"),
+		       page_size);
+
+  return GRUB_ERR_NONE;
+}
+
+static grub_err_t
+android_add_boot_sections (struct source *src, union android_hdr *raw,
+			   int version)
+{
+  grub_uint32_t page, kernel_size, ramdisk_size;
+  grub_off_t offset;
+
+  if (version >= 3)
+    {
+      page = BOOT_IMAGE_HEADER_V3_PAGESIZE;
+      kernel_size = raw->v3.kernel_size;
+      ramdisk_size = raw->v3.ramdisk_size;
+    }
+  else
+    {
+      page = raw->v0.page_size;
+      kernel_size = raw->v0.kernel_size;
+      ramdisk_size = raw->v0.ramdisk_size;
+    }
+
+  if (android_check_page_size (page))
+    return grub_errno;
+
+  // the header takes the first page, sections follow page aligned
+  offset = page;
+  if (android_add_section ("kernel", src, offset, kernel_size,
+			   REGION_KERNEL))
+    return grub_errno;
+  offset += ALIGN (kernel_size, page);
+
+  if (android_add_section ("ramdisk", src, offset, ramdisk_size,
+			   REGION_RAMDISK))
+    return grub_errno;
+  offset += ALIGN (ramdisk_size, page);
+
+  if (version >= 4)
+    return android_add_section ("boot signature", src, offset,
+				raw->v4.signature_size, REGION_NONE);
+  if (version >= 3)
+    return GRUB_ERR_NONE;
+
+  if (android_add_section ("second", src, offset, raw->v0.second_size,
+			   REGION_SECOND))
+    return grub_errno;
+  offset += ALIGN (raw->v0.second_size, page);
+
+  // there's no overlay support, so the recovery dtbo is never needed
+  if (version >= 1)
+    {
+      if (android_add_section ("recovery dtbo", src,
+			       raw->v1.recovery_dtbo_offset,
+			       raw->v1.recovery_dtbo_size, REGION_NONE))
+	return grub_errno;
+      offset += ALIGN (raw->v1.recovery_dtbo_size, page);
+    }
+  else if (android_add_section ("dt", src, offset, raw->v0.dt_size,
+				REGION_NONE))
+    return grub_errno;
+
+  if (version >= 2)
+    return android_add_section ("dtb", src, offset, raw->v2.dtb_size,
+				REGION_DTB);
+
+  return GRUB_ERR_NONE;
+}
+
+static grub_err_t
+android_add_vendor_ramdisks (struct source *src, union vendor_hdr *raw,
+			     grub_off_t ramdisk_offset, grub_off_t table_offset,
+			     int recovery)
+{
+  grub_uint32_t entry_size = raw->v4.vendor_ramdisk_table_entry_size;
+  grub_uint32_t num = raw->v4.vendor_ramdisk_table_entry_num;
+  grub_uint32_t table_size = raw->v4.vendor_ramdisk_table_size;
+  char *table;
+  grub_uint32_t i;
+
+  if (entry_size < sizeof (vendor_ramdisk_table_entry_v4)
+      || (grub_uint64_t) entry_size * num > table_size
+      || table_offset + table_size > src->size)
+    return grub_error (GRUB_ERR_BAD_OS, N_("invalid vendor ramdisk table"));
+
+  table = grub_malloc (table_size);
+  if (!table)
+    return grub_errno;
+
+  if (src->read (src, table_offset, table_size, table))
+    goto out;
+
+  for (i = 0; i < num; i++)
+    {
+      vendor_ramdisk_table_entry_v4 *entry =
+	(vendor_ramdisk_table_entry_v4 *) (table + i * entry_size);
+      unsigned region = REGION_RAMDISK;
+
+      // the recovery fragment is only needed to boot into recovery
+      if (entry->ramdisk_type == VENDOR_RAMDISK_TYPE_RECOVERY && !recovery)
+	region = REGION_NONE;
+
+      if (entry->ramdisk_offset + (grub_uint64_t) entry->ramdisk_size
+	  > raw->v3.vendor_ramdisk_size)
+	{
+	  grub_error (GRUB_ERR_BAD_OS, N_("invalid vendor ramdisk table"));
+	  goto out;
+	}
+
+      if (android_add_section ("vendor ramdisk", src,
+			       ramdisk_offset + entry->ramdisk_offset,
+			       entry->ramdisk_size, region))
+	goto out;
+    }
+
+out:
+  grub_free (table);
+  return grub_errno;
+}
+
+static grub_err_t
+android_add_vendor_sections (struct source *src, union vendor_hdr *raw,
+			     int recovery)
+{
+  grub_uint32_t page = raw->v3.page_size;
+  grub_off_t offset, ramdisk_offset;
+
+  if (android_check_page_size (page))
+    return grub_errno;
+
+  offset = ALIGN (raw->v3.header_size, page);
+  ramdisk_offset = offset;
+  offset += ALIGN (raw->v3.vendor_ramdisk_size, page);
+
+  if (raw->v3.header_version < 4
+      || !raw->v4.vendor_ramdisk_table_entry_num)
+    {
+      if (android_add_section ("vendor ramdisk", src, ramdisk_offset,
+			       raw->v3.vendor_ramdisk_size, REGION_RAMDISK))
+	return grub_errno;
+    }
+  else if (android_add_vendor_ramdisks (src, raw, ramdisk_offset,
+					offset + ALIGN (raw->v3.dtb_size,
+							page), recovery))
+    return grub_errno;
+
+  if (android_add_section ("dtb", src, offset, raw->v3.dtb_size, REGION_DTB))
+    return grub_errno;
+  offset += ALIGN (raw->v3.dtb_size, page);
+
+  if (raw->v3.header_version < 4)
+    return GRUB_ERR_NONE;
+
+  // bootconfig isn't supported, androidboot.* has to be on the cmdline
+  offset += ALIGN (raw->v4.vendor_ramdisk_table_size, page);
+  return android_add_section ("bootconfig", src, offset,
+			      raw->v4.bootconfig_size, REGION_NONE);
+}
+
+static struct android_section *
+android_find_section (unsigned region)
+{
+  unsigned i;
+
+  for (i = 0; i < num_sections; i++)
+    if (sections[i].region == region)
+      return &sections[i];
+
+  return NULL;
+}
+
+static grub_err_t
+android_check_sections (void)
+{
+  unsigned i;
+
+  if (!android_find_section (REGION_KERNEL))
+    return grub_error (GRUB_ERR_BAD_OS, N_("no kernel in boot image"));
+
+  for (i = 0; i < num_sections; i++)
+    if (sections[i].offset + sections[i].size > sections[i].src->size)
+      return grub_error (GRUB_ERR_BAD_OS,
+			 N_("%s exceeds boot image size"), sections[i].name);
+
+  return GRUB_ERR_NONE;
+}
+
+// Sections are wrapped in a file so the compression filters (gzio, xzio,
+// lzopio, lz4io) can be stacked on top of them, the same way they are on
+// files opened from a filesystem.
+static grub_ssize_t
+section_file_read (grub_file_t file, char *buf, grub_size_t len)
+{
+  struct android_section *sec = file->data;
+
+  if (sec->src->read (sec->src, sec->offset + file->offset, len, buf))
+    return -1;
+
+  return len;
+}
+
+static struct grub_fs section_file_fs = {
+  .name = "android_section",
+  .dir = 0,
+  .open = 0,
+  .read = section_file_read,
+  .close = 0,
+  .label = 0,
+  .next = 0
+};
+
+static grub_err_t
+android_open_section (struct android_section *sec)
+{
+  grub_file_t file, last_file = NULL;
+  grub_file_filter_id_t filter;
+
+  file = grub_zalloc (sizeof (*file));
+  if (!file)
+    return grub_errno;
+
+  file->data = sec;
+  file->fs = &section_file_fs;
+  file->size = sec->size;
+
+  for (filter = GRUB_FILE_FILTER_COMPRESSION_FIRST;
+       file && filter <= GRUB_FILE_FILTER_COMPRESSION_LAST; filter++)
+    if (grub_file_filters_enabled[filter])
+      {
+	last_file = file;
+	file = grub_file_filters_enabled[filter] (file, sec->name);
+      }
+
+  if (!file)
+    {
+      grub_file_close (last_file);
+      return grub_errno;
+    }
+
+  // none of the filters recognized it
+  if (file->fs == &section_file_fs)
+    {
+      grub_file_close (file);
+      return GRUB_ERR_NONE;
+    }
+
+  if (file->size == GRUB_FILE_SIZE_UNKNOWN
+      || file->size > GRUB_UINT_MAX)
+    {
+      grub_file_close (file);
+      return grub_error (GRUB_ERR_BAD_OS,
+			 N_("cannot determine decompressed size of %s"),
+			 sec->name);
+    }
+
+  sec->file = file;
+  sec->load_size = file->size;
+  grub_dprintf ("loader", "%s: %s, %u bytes decompress to %u bytes\n",
+		sec->name, file->fs->name, sec->size, sec->load_size);
+
+  return GRUB_ERR_NONE;
+}
+
+static void
+android_close_sections (void)
+{
+  unsigned i;
+
+  for (i = 0; i < num_sections; i++)
+    if (sections[i].file)
+      {
+	grub_file_close (sections[i].file);
+	sections[i].file = NULL;
+      }
+}
+
+// Kernel and ramdisks may be compressed with any of the formats GRUB has
+// a filter loaded for. Those get decompressed while reading, so they take
+// up their decompressed size in memory.
+static grub_err_t
+android_open_sections (void)
+{
+  unsigned i;
+
+  for (i = 0; i < num_sections; i++)
+    {
+      struct android_section *sec = &sections[i];
+
+      if (sec->region != REGION_KERNEL && sec->region != REGION_RAMDISK)
+	continue;
+
+      if (android_open_section (sec))
+	{
+	  android_close_sections ();
+	  return grub_errno;
+	}
+    }
+
+  return GRUB_ERR_NONE;
+}
+
+// Place sections of the same region back to back. Ramdisks get padded to
+// 4 bytes, the kernel needs each decompressed cpio archive to start
+// aligned and skips zeros in between.
+static void
+android_layout_sections (void)
+{
+  unsigned i;
+
+  for (i = 0; i < REGION_COUNT; i++)
+    regions[i].size = 0;
+
+  for (i = 0; i < num_sections; i++)
+    {
+      struct android_section *sec = &sections[i];
+      struct android_region *reg;
+
+      if (sec->region == REGION_NONE)
+	continue;
+
+      reg = &regions[sec->region];
+      sec->pad = 0;
+      if (sec->region == REGION_RAMDISK)
+	sec->pad = ALIGN (reg->size, 4) - reg->size;
+      sec->region_offset = reg->size + sec->pad;
+      reg->size = sec->region_offset + sec->load_size;
+    }
+}
+
+static void
+android_free_sections (void)
+{
+  unsigned i;
+
+  for (i = 0; i < REGION_COUNT; i++)
+    {
+      if (regions[i].pages)
+	grub_efi_free_pages (*regions[i].addr, regions[i].pages);
+      regions[i].pages = 0;
+    }
+}
+
+static grub_err_t
+android_allocate_sections (void)
+{
+  unsigned i;
+
+  for (i = 0; i < REGION_COUNT; i++)
+    {
+      struct android_region *reg = &regions[i];
+      grub_efi_uintn_t pages = BYTES_TO_PAGES (reg->size + reg->headroom);
+      void *mem;
+
+      if (!reg->size)
+	continue;
+
+      mem = grub_efi_allocate_pages (*reg->addr, pages);
+      if (!mem)
+	{
+	  android_free_sections ();
+	  if (!grub_errno)
+	    grub_error (GRUB_ERR_OUT_OF_MEMORY,
+			N_("cannot allocate %s memory at 0x%08x"),
+			reg->name, *reg->addr);
+	  return grub_errno;
+	}
+
+      *reg->addr = (grub_addr_t) mem;
+      reg->pages = pages;
+    }
+
+  return GRUB_ERR_NONE;
+}
+
+// Decompress a section into DEST. The filters pull their input from the
+// source in small pieces as they go, so reading and decompressing are
+// interleaved and the compressed data never has to be held in memory.
+static grub_err_t
+android_read_compressed (struct android_section *sec, char *dest)
+{
+  grub_uint32_t done = 0;
+
+  if (grub_file_seek (sec->file, 0) == (grub_off_t) -1)
+    return grub_errno;
+
+  while (done < sec->load_size)
+    {
+      grub_size_t len = MIN (sec->load_size - done, DECOMPRESS_CHUNK);
+
+      if (grub_file_read (sec->file, dest + done, len) != (grub_ssize_t) len)
+	{
+	  if (!grub_errno)
+	    grub_error (GRUB_ERR_BAD_OS, N_("premature end of %s"),
+			sec->name);
+	  return grub_errno;
+	}
+      done += len;
+    }
+
+  return GRUB_ERR_NONE;
+}
+
+// Read the needed sections in table order, each one with a single large
+// read (or one decompression pass) straight into its final location.
+// Nothing but the reads happens in between, so every source sees one
+// sequential pass over its image.
+static grub_err_t
+android_read_sections (void)
+{
+  unsigned i;
+
+  for (i = 0; i < num_sections; i++)
+    {
+      struct android_section *sec = &sections[i];
+      grub_uint64_t start;
+      char *dest;
+
+      if (sec->region == REGION_NONE)
+	{
+	  grub_dprintf ("loader", "%s: %u bytes skipped\n", sec->name,
+			sec->size);
+	  continue;
+	}
+
+      dest = (char *) *regions[sec->region].addr + sec->region_offset;
+      grub_memset (dest - sec->pad, 0, sec->pad);
+
+      start = grub_get_time_ms ();
+      if (sec->file)
+	{
+	  if (android_read_compressed (sec, dest))
+	    return grub_errno;
+	}
+      else if (sec->src->read (sec->src, sec->offset, sec->size, dest))
+	return grub_errno;
+      sec->time_ms = grub_get_time_ms () - start;
+
+      grub_boot_time ("Loaded android %s", sec->name);
+      grub_dprintf ("loader", "%s: %u bytes @ %p in %llu ms\n",
+		    sec->name, sec->load_size, dest,
+		    (unsigned long long) sec->time_ms);
+    }
+
+  return GRUB_ERR_NONE;
+}
+
+/*
+ * HEADER PARSING
+ */
+
+// Fill the legacy header the rest of the loader works with from a boot
+// image header of any version and the vendor_boot header that comes with
+// v3 and later.
+static void
+android_normalize_header (boot_img_hdr * hdr, union android_hdr *raw,
+			  union vendor_hdr *vraw, int version)
+{
+  if (version < 3)
+    {
+      grub_memcpy (hdr, &raw->v0, sizeof (*hdr));
+      // the dt.img size field holds the version now
+      if (version > 0)
+	hdr->dt_size = 0;
+      return;
+    }
+
+  grub_memset (hdr, 0, sizeof (*hdr));
+  grub_memcpy (hdr->magic, raw->v3.magic, BOOT_MAGIC_SIZE);
+  grub_memcpy (hdr->name, vraw->v3.name, BOOT_NAME_SIZE);
+  hdr->kernel_addr = vraw->v3.kernel_addr;
+  hdr->ramdisk_addr = vraw->v3.ramdisk_addr;
+  hdr->tags_addr = vraw->v3.tags_addr;
+  hdr->page_size = vraw->v3.page_size;
+}
+
+static char *
+android_get_cmdline (union android_hdr *raw, union vendor_hdr *vraw,
+		     int version)
+{
+  if (version < 3)
+    {
+      // extra_cmdline continues cmdline without a separator
+      char *cmdline = grub_strndup ((const char *) raw->v0.cmdline,
+				    BOOT_ARGS_SIZE);
+      char *extra = grub_strndup ((const char *) raw->v0.extra_cmdline,
+				  BOOT_EXTRA_ARGS_SIZE);
+      char *ret = NULL;
+
+      if (cmdline && extra)
+	ret = grub_xasprintf ("%s%s", cmdline, extra);
+      grub_free (cmdline);
+      grub_free (extra);
+      return ret;
+    }
+  else
+    {
+      char *cmdline = grub_strndup ((const char *) raw->v3.cmdline,
+				    BOOT_ARGS_SIZE_V3);
+      char *vendor = grub_strndup ((const char *) vraw->v3.cmdline,
+				   VENDOR_BOOT_ARGS_SIZE);
+      char *ret = NULL;
+
+      if (cmdline && vendor)
+	ret = grub_xasprintf ("%s%s%s", vendor, *vendor ? " " : "", cmdline);
+      grub_free (cmdline);
+      grub_free (vendor);
+      return ret;
+    }
+}
+
 /*
  * ANDROID LOADING
  */
@@ -350,6 +1064,7 @@ static grub_err_t
 android_boot (void)
 {
   kernel_entry_t linuxmain;
+  void *boot_data;
 
   if (!bootinfo.hdr)
     return grub_error (GRUB_ERR_BUG, "Invalid boot header");
@@ -359,12 +1074,17 @@ android_boot (void)
   else
     linuxmain = (kernel_entry_t) bootinfo.hdr->kernel_addr;
 
+  if (bootinfo.dtb_addr)
+    boot_data = (void *) bootinfo.dtb_addr;
+  else
+    boot_data = (void *) bootinfo.hdr->tags_addr;
+
   grub_dprintf
     ("loader",
-     "Booting kernel @ %p (%u), ramdisk @ 0x%08x (%u), tags/device tree @ 0x%08x (%u)\n",
+     "Booting kernel @ %p (%u), ramdisk @ 0x%08x (%u), tags/device tree @ %p (%u)\n",
      linuxmain, bootinfo.hdr->kernel_size, bootinfo.hdr->ramdisk_addr,
-     bootinfo.hdr->ramdisk_size, bootinfo.hdr->tags_addr,
-     bootinfo.hdr->dt_size);
+     bootinfo.hdr->ramdisk_size, boot_data,
+     bootinfo.dtb_addr ? bootinfo.dtb_size : bootinfo.hdr->dt_size);
 
   // mach type override
   grub_uint32_t mach_type = grub_arm_firmware_get_machine_type ();
@@ -388,7 +1108,7 @@ android_boot (void)
 
   grub_arm_disable_caches_mmu ();
 
-  linuxmain (0, mach_type, (void *) bootinfo.hdr->tags_addr);
+  linuxmain (0, mach_type, boot_data);
 
   return grub_error (GRUB_ERR_BAD_OS, "Linux call returned");
 }
@@ -441,45 +1161,170 @@ android_generate_atags (boot_img_hdr * hdr, const char *cmdline)
   return GRUB_ERR_NONE;
 }
 
+// Update the first device tree of the dtb section where it was loaded,
+// growing it into the headroom reserved behind the section.
 static grub_err_t
-android_load (struct source *src, int argc, char *argv[], int multiboot)
+android_prepare_fdt (boot_img_hdr * hdr, const char *cmdline)
 {
+  void *fdt = (void *) bootinfo.dtb_addr;
+  grub_fdt_edit_t edit;
+  int node;
+
+  if (grub_fdt_check_header (fdt, regions[REGION_DTB].size))
+    return grub_error (GRUB_ERR_BAD_OS, N_("invalid device tree"));
+
+  // index the tree once, vendor DTBs are big enough for repeated walks
+  // and block moves to show
+  edit = grub_fdt_edit_begin (fdt);
+  if (!edit)
+    goto failure;
+
+  // find or create '/chosen' node
+  node = grub_fdt_edit_find_subnode (edit, 0, "chosen");
+  if (node < 0)
+    node = grub_fdt_edit_add_subnode (edit, 0, "chosen");
+  if (node < 0)
+    goto failure;
+
+  if (grub_fdt_edit_set_prop (edit, node, "bootargs", cmdline,
+			      grub_strlen (cmdline) + 1))
+    goto failure;
+
+  if (hdr->ramdisk_size > 0)
+    {
+      if (grub_fdt_edit_set_prop32 (edit, node, "linux,initrd-start",
+				    hdr->ramdisk_addr))
+	goto failure;
+      if (grub_fdt_edit_set_prop32 (edit, node, "linux,initrd-end",
+				    hdr->ramdisk_addr + hdr->ramdisk_size))
+	goto failure;
+    }
+
+  // write the result back in place, grown into the headroom
+  if (grub_fdt_edit_commit (edit, fdt, grub_fdt_get_totalsize (fdt)
+			    + regions[REGION_DTB].headroom))
+    goto failure;
+  grub_fdt_edit_free (edit);
+
+  bootinfo.dtb_size = grub_fdt_get_totalsize (fdt);
+
+  return GRUB_ERR_NONE;
+
+failure:
+  grub_fdt_edit_free (edit);
+  return grub_error (GRUB_ERR_BAD_OS, N_("unable to prepare FDT"));
+}
+
+static grub_err_t
+android_load (struct source *src, struct source *vsrc, int argc,
+	      char *argv[], int multiboot, int recovery)
+{
+  union android_hdr *raw;
+  union vendor_hdr *vraw = NULL;
   boot_img_hdr *hdr;
+  char *img_cmdline = NULL;
+  int version;
   grub_size_t size_linux_args, size_bootimg_cmdline, size_initrd,
     size_grubdir_key, size_grubdir_val;
 
   grub_dprintf ("loader", "Loading android\n");
 
+  bootinfo.dtb_addr = 0;
+  bootinfo.dtb_size = 0;
+
   //
   // parse header
   //
 
   // read header
-  hdr = (boot_img_hdr *) grub_malloc (sizeof (boot_img_hdr) + 100);
-  if (!hdr)
+  raw = grub_zalloc (sizeof (*raw));
+  if (!raw)
     goto err_out;
-  if (src->read (src, 0, sizeof (boot_img_hdr) + 100, hdr))
-    goto err_free_hdr;
+  if (src->read (src, 0, MIN (sizeof (*raw), src->size), raw))
+    goto err_free_raw;
 
   // check magic
-  if (grub_memcmp (hdr->magic, BOOT_MAGIC, BOOT_MAGIC_SIZE))
+  if (grub_memcmp (raw->v0.magic, BOOT_MAGIC, BOOT_MAGIC_SIZE))
     {
       grub_error (GRUB_ERR_BAD_ARGUMENT, N_("Invalid magic in boot header"));
-      goto err_free_hdr;
+      goto err_free_raw;
+    }
+
+  version = boot_img_hdr_version (&raw->v0);
+  grub_dprintf ("loader", "boot image header version %d\n", version);
+
+  // v3 and later keep load addresses and the dtb in vendor_boot
+  if (version >= 3)
+    {
+      if (!vsrc)
+	{
+	  grub_error (GRUB_ERR_BAD_ARGUMENT,
+		      N_("boot image v%d needs a vendor_boot image"), version);
+	  goto err_free_raw;
+	}
+
+      vraw = grub_zalloc (sizeof (*vraw));
+      if (!vraw)
+	goto err_free_raw;
+      if (vsrc->read (vsrc, 0, MIN (sizeof (*vraw), vsrc->size), vraw))
+	goto err_free_raw;
+
+      if (grub_memcmp (vraw->v3.magic, VENDOR_BOOT_MAGIC,
+		       VENDOR_BOOT_MAGIC_SIZE)
+	  || vraw->v3.header_version < 3)
+	{
+	  grub_error (GRUB_ERR_BAD_ARGUMENT,
+		      N_("Invalid magic in vendor boot header"));
+	  goto err_free_raw;
+	}
     }
 
-  // get image sizes
-  grub_size_t kernel_size = ALIGN (hdr->kernel_size, hdr->page_size);
-  grub_size_t ramdisk_size = ALIGN (hdr->ramdisk_size, hdr->page_size);
-  grub_size_t second_size = ALIGN (hdr->second_size, hdr->page_size);
-  //grub_size_t dt_size = ALIGN (hdr->dt_size, hdr->page_size);
+  hdr = grub_malloc (sizeof (*hdr));
+  if (!hdr)
+    goto err_free_raw;
+  android_normalize_header (hdr, raw, vraw, version);
+
+  img_cmdline = android_get_cmdline (raw, vraw, version);
+  if (!img_cmdline)
+    goto err_free_hdr;
+
+  // build section table, the vendor ramdisks go in front of the
+  // generic one
+  android_init_sections (hdr);
+  if (vraw && android_add_vendor_sections (vsrc, vraw, recovery))
+    goto err_free_hdr;
+  if (android_add_boot_sections (src, raw, version))
+    goto err_free_hdr;
+  if (android_check_sections ())
+    goto err_free_hdr;
+  if (android_open_sections ())
+    goto err_free_hdr;
+  android_layout_sections ();
+
+  hdr->kernel_size = regions[REGION_KERNEL].size;
+  hdr->ramdisk_size = regions[REGION_RAMDISK].size;
+
+  // peek at the kernel header to find out which address variable applies
+  struct android_section *ksec = android_find_section (REGION_KERNEL);
+  struct kernel64_hdr khdr;
+  if (ksec->file)
+    {
+      if (grub_file_read (ksec->file, &khdr, sizeof (khdr))
+	  != sizeof (khdr))
+	{
+	  if (!grub_errno)
+	    grub_error (GRUB_ERR_BAD_OS, N_("premature end of kernel"));
+	  goto err_free_hdr;
+	}
+    }
+  else if (ksec->src->read (ksec->src, ksec->offset, sizeof (khdr), &khdr))
+    goto err_free_hdr;
+  int is_arm64 = IS_ARM64 (&khdr);
 
   //
   // update addresses
   //
 
-  int is_arm64 = IS_ARM64 (hdr->kernel_addr + hdr->page_size);
-
   // kernel
   grub_size_t uefi_kernel_addr_sz;
   grub_uint64_t *uefi_kernel_addr =
@@ -511,80 +1356,24 @@ android_load (struct source *src, int argc, char *argv[], int multiboot)
   if (uefi_tags_addr)
     grub_free (uefi_tags_addr);
 
-  //
-  // load images
-  //
-
-  // allocate kernel memory
-  hdr->kernel_addr =
-    (grub_addr_t) grub_efi_allocate_pages (hdr->kernel_addr,
-					   BYTES_TO_PAGES (hdr->kernel_size));
-  if (!hdr->kernel_addr)
-    return grub_errno;
-
-  // load kernel
-  grub_off_t offset = hdr->page_size;
-  if (src->read (src, offset, kernel_size, (void *) hdr->kernel_addr))
-    goto err_free_hdr;
-
-  if (ramdisk_size > 0)
+  // device tree, placed with the tags unless the header says otherwise
+  if (regions[REGION_DTB].size)
     {
-      // allocate ramdisk memory
-      hdr->ramdisk_addr =
-	(grub_addr_t) grub_efi_allocate_pages (hdr->ramdisk_addr,
-					       BYTES_TO_PAGES
-					       (hdr->ramdisk_size));
-      if (!hdr->ramdisk_addr)
-	return grub_errno;
-
-      // load ramdisk
-      offset += kernel_size;
-      if (src->read (src, offset, ramdisk_size, (void *) hdr->ramdisk_addr))
-	goto err_free_hdr;
-
-      // patch ramdisk
-      if (multiboot && android_patch_ramdisk (hdr))
-	goto err_remove_bootinfo;
+      if (vraw)
+	bootinfo.dtb_addr = (grub_uint32_t) vraw->v3.dtb_addr;
+      else
+	bootinfo.dtb_addr = (grub_uint32_t) raw->v2.dtb_addr;
+      if (!bootinfo.dtb_addr)
+	bootinfo.dtb_addr = hdr->tags_addr;
     }
 
-  // load second
-  offset += ramdisk_size;
-  if (second_size > 0)
-    {
-      // allocate second memory
-      hdr->second_addr =
-	(grub_addr_t) grub_efi_allocate_pages (hdr->second_addr,
-					       BYTES_TO_PAGES
-					       (hdr->second_size));
-      if (!hdr->second_addr)
-	return grub_errno;
-
-      if (src->read (src, offset, second_size, (void *) hdr->second_addr))
-	goto err_free_hdr;
-    }
-
-  // load devicetree
-  offset += second_size;
-#if 0
-  if (dt_size > 0)
-    {
-      info.dt = grub_malloc (dt_size);
-      info.dt_size = dt_size;
-      if (src->read (src, offset, dt_size, info.dt))
-	goto err_remove_bootinfo;
-    }
-#endif
-
-  // set bootinfo
-  bootinfo.hdr = hdr;
-
   //
   // calculate cmdline size
   //
 
   // basic cmdline(bootimg + args)
   size_linux_args = grub_loader_cmdline_size (argc, argv);
-  size_bootimg_cmdline = grub_strlen ((const char *) hdr->cmdline);
+  size_bootimg_cmdline = grub_strlen (img_cmdline);
   grub_size_t cmdline_size = size_bootimg_cmdline + size_linux_args;
 
   // uefi cmdline
@@ -616,7 +1405,7 @@ android_load (struct source *src, int argc, char *argv[], int multiboot)
 
   linux_args = grub_malloc (cmdline_size + 1);
   if (!linux_args)
-    goto err_remove_bootinfo;
+    goto err_free_hdr;
 
   //
   // create cmdline
@@ -624,7 +1413,7 @@ android_load (struct source *src, int argc, char *argv[], int multiboot)
 
   // bootimg args
   int cmdline_pos = 0;
-  grub_memcpy (linux_args + cmdline_pos, hdr->cmdline, size_bootimg_cmdline);
+  grub_memcpy (linux_args + cmdline_pos, img_cmdline, size_bootimg_cmdline);
   cmdline_pos += size_bootimg_cmdline;
 
   // uefi
@@ -658,25 +1447,105 @@ android_load (struct source *src, int argc, char *argv[], int multiboot)
   // terminate
   linux_args[cmdline_pos] = '\0';
 
+  //
+  // load images
+  //
+
+  // the chosen node grows by the cmdline and the initrd properties
+  if (regions[REGION_DTB].size)
+    regions[REGION_DTB].headroom =
+      cmdline_pos + 1 + FDT_ADDITIONAL_ENTRIES_SIZE;
+
+  // multiboot files get appended to the ramdisk. As long as that doesn't
+  // run into the tags, reserve room for them right behind the ramdisk so
+  // they can be added in place.
+  if (multiboot)
+    {
+      if (android_load_multiboot_files ())
+	goto err_free_args;
+
+      struct android_region *rd = &regions[REGION_RAMDISK];
+      grub_size_t headroom = android_multiboot_files_size ();
+      if (rd->size > 0 && (hdr->tags_addr < hdr->ramdisk_addr ||
+			   hdr->tags_addr >= hdr->ramdisk_addr + rd->size
+			   + headroom))
+	rd->headroom = headroom;
+    }
+
+  // place all sections first so the reads below run back-to-back
+  if (android_allocate_sections ())
+    goto err_free_multiboot_files;
+
+  // stream the images into their final location
+  if (android_read_sections ())
+    goto err_free_sections;
+  android_close_sections ();
+
+  // patch ramdisk
+  if (multiboot && hdr->ramdisk_size > 0)
+    {
+      struct android_region *rd = &regions[REGION_RAMDISK];
+      grub_uint32_t old_ramdisk_addr = hdr->ramdisk_addr;
+
+      if (rd->headroom)
+	{
+	  if (android_append_ramdisk (hdr, rd->headroom))
+	    goto err_free_sections;
+	}
+      else
+	{
+	  if (android_patch_ramdisk (hdr))
+	    goto err_free_sections;
+
+	  // the patched ramdisk was placed somewhere else
+	  grub_efi_free_pages (old_ramdisk_addr, rd->pages);
+	  rd->pages = 0;
+	}
+    }
+  android_free_multiboot_files ();
+
   //
   // generate tags
   //
-  if (hdr->dt_size > 0)
+  if (bootinfo.dtb_addr)
+    {
+      if (android_prepare_fdt (hdr, linux_args))
+	goto err_free_sections;
+    }
+  else if (hdr->dt_size > 0)
     {
       grub_error (GRUB_ERR_BUG, N_("DT is not implemented."));
-      goto err_remove_bootinfo;
+      goto err_free_sections;
     }
   else
     {
       android_generate_atags (hdr, linux_args);
     }
 
+  // set bootinfo
+  bootinfo.hdr = hdr;
+
+  grub_free (img_cmdline);
+  grub_free (vraw);
+  grub_free (raw);
+
   return GRUB_ERR_NONE;
 
-err_remove_bootinfo:
-  bootinfo.hdr = NULL;
+err_free_sections:
+  android_free_sections ();
+err_free_multiboot_files:
+  android_free_multiboot_files ();
+err_free_args:
+  grub_free (linux_args);
+  linux_args = NULL;
 err_free_hdr:
+  android_close_sections ();
+  bootinfo.dtb_addr = 0;
+  grub_free (img_cmdline);
   grub_free (hdr);
+err_free_raw:
+  grub_free (vraw);
+  grub_free (raw);
 err_out:
   if (!grub_errno)
     grub_error (GRUB_ERR_BUG, N_("%s: Unknown error."), __func__);
@@ -692,50 +1561,88 @@ android_unload (void)
 }
 
 static grub_err_t
-grub_cmd_android (grub_command_t cmd, int argc, char *argv[])
+android_open_source (char *name, struct source *src)
 {
-  grub_dl_ref (my_mod);
-  struct source src;
-  int namelen;
+  int namelen = grub_strlen (name);
 
-  if (argc == 0)
-    return grub_error (GRUB_ERR_BAD_ARGUMENT, N_("filename expected"));
-
-  namelen = grub_strlen (argv[0]);
-  if ((argv[0][0] == '(') && (argv[0][namelen - 1] == ')'))
+  if ((name[0] == '(') && (name[namelen - 1] == ')'))
     {
       // open disk
-      argv[0][namelen - 1] = 0;
-      grub_disk_t disk = grub_disk_open (&argv[0][1]);
+      name[namelen - 1] = 0;
+      grub_disk_t disk = grub_disk_open (&name[1]);
+      name[namelen - 1] = ')';
       if (!disk)
-	goto dl_unref;
+	return grub_errno;
 
-      src.read = &disk_read;
-      src.free = &disk_free;
-      src.size = grub_disk_get_size (disk) * GRUB_DISK_SECTOR_SIZE;
-      src.priv = disk;
+      src->read = &disk_read;
+      src->free = &disk_free;
+      src->size = grub_disk_get_size (disk) * GRUB_DISK_SECTOR_SIZE;
+      src->priv = disk;
     }
   else
     {
       // open file
-      grub_file_t file = grub_file_open (argv[0]);
+      grub_file_t file = grub_file_open (name);
       if (!file)
-	goto dl_unref;
+	return grub_errno;
+
+      src->read = &file_read;
+      src->free = &file_free;
+      src->size = grub_file_size (file);
+      src->priv = file;
+    }
+
+  return GRUB_ERR_NONE;
+}
+
+static grub_err_t
+grub_cmd_android (grub_command_t cmd, int argc, char *argv[])
+{
+  grub_dl_ref (my_mod);
+  struct source src, vsrc;
+  char *vendor_boot = NULL;
+  int recovery = 0;
 
-      src.read = &file_read;
-      src.free = &file_free;
-      src.size = grub_file_size (file);
-      src.priv = file;
+  // options
+  while (argc != 0 && grub_strncmp (argv[0], "--", 2) == 0)
+    {
+      if (grub_strncmp (argv[0], "--vendor-boot=", 14) == 0)
+	vendor_boot = argv[0] + 14;
+      else if (grub_strcmp (argv[0], "--recovery") == 0)
+	recovery = 1;
+      else
+	{
+	  grub_error (GRUB_ERR_BAD_ARGUMENT, N_("invalid option `%s'"),
+		      argv[0]);
+	  goto dl_unref;
+	}
+      argc--;
+      argv++;
     }
 
+  if (argc == 0)
+    {
+      grub_error (GRUB_ERR_BAD_ARGUMENT, N_("filename expected"));
+      goto dl_unref;
+    }
+
+  if (android_open_source (argv[0], &src))
+    goto dl_unref;
+
+  if (vendor_boot && android_open_source (vendor_boot, &vsrc))
+    goto source_free;
+
   // load android image
   argc--;
   argv++;
   if (android_load
-      (&src, argc, argv, !grub_strcmp (cmd->name, "android.multiboot")))
-    goto source_free;
+      (&src, vendor_boot ? &vsrc : NULL, argc, argv,
+       !grub_strcmp (cmd->name, "android.multiboot"), recovery))
+    goto vendor_source_free;
 
-  // close source
+  // close sources
+  if (vendor_boot)
+    vsrc.free (&vsrc);
   src.free (&src);
 
   // set loader
@@ -743,6 +1650,9 @@ grub_cmd_android (grub_command_t cmd, int argc, char *argv[])
 
   return GRUB_ERR_NONE;
 
+vendor_source_free:
+  if (vendor_boot)
+    vsrc.free (&vsrc);
 source_free:
   src.free (&src);
 dl_unref:
@@ -757,10 +1667,14 @@ static grub_command_t cmd_android, cmd_android_multiboot;
 GRUB_MOD_INIT (android)
 {
   cmd_android = grub_register_command ("android", grub_cmd_android,
-				       0, N_("Boot Android Image."));
+				       N_("[--vendor-boot=IMAGE] [--recovery] "
+					  "IMAGE [ARGS...]"),
+				       N_("Boot Android Image."));
 
   cmd_android_multiboot =
-    grub_register_command ("android.multiboot", grub_cmd_android, 0,
+    grub_register_command ("android.multiboot", grub_cmd_android,
+			   N_("[--vendor-boot=IMAGE] [--recovery] "
+			      "IMAGE [ARGS...]"),
 			   N_("Boot Android Image in multiboot mode."));
   my_mod = mod;
 }
@@ -161,22 +161,21 @@ linux_prepare_fdt (void)
   int node;
   int retval;
   int tmp_size;
-  void *tmp_fdt;
+  grub_fdt_edit_t edit;
 
   tmp_size = grub_fdt_get_totalsize (fdt_addr) + 0x100 + grub_strlen (linux_args);
-  tmp_fdt = grub_malloc (tmp_size);
-  if (!tmp_fdt)
-    return grub_errno;
 
-  grub_memcpy (tmp_fdt, fdt_addr, grub_fdt_get_totalsize (fdt_addr));
-  grub_fdt_set_totalsize (tmp_fdt, tmp_size);
+  /* Collect all edits first and write the tree back in a single pass.  */
+  edit = grub_fdt_edit_begin (fdt_addr);
+  if (!edit)
+    goto failure;
 
   /* Find or create '/chosen' node */
-  node = grub_fdt_find_subnode (tmp_fdt, 0, "chosen");
+  node = grub_fdt_edit_find_subnode (edit, 0, "chosen");
   if (node < 0)
     {
       grub_dprintf ("linux", "No 'chosen' node in FDT - creating.\n");
-      node = grub_fdt_add_subnode (tmp_fdt, 0, "chosen");
+      node = grub_fdt_edit_add_subnode (edit, 0, "chosen");
       if (node < 0)
 	goto failure;
     }
@@ -184,8 +183,8 @@ linux_prepare_fdt (void)
   grub_dprintf ("linux", "linux_args: '%s'\n", linux_args);
 
   /* Generate and set command line */
-  retval = grub_fdt_set_prop (tmp_fdt, node, "bootargs", linux_args,
-			      grub_strlen (linux_args) + 1);
+  retval = grub_fdt_edit_set_prop (edit, node, "bootargs", linux_args,
+				   grub_strlen (linux_args) + 1);
   if (retval)
     goto failure;
 
@@ -198,26 +197,28 @@ linux_prepare_fdt (void)
       grub_dprintf ("loader", "Initrd @ 0x%08x-0x%08x\n",
 		    initrd_start, initrd_end);
 
-      retval = grub_fdt_set_prop32 (tmp_fdt, node, "linux,initrd-start",
-				    initrd_start);
+      retval = grub_fdt_edit_set_prop32 (edit, node, "linux,initrd-start",
+					 initrd_start);
       if (retval)
 	goto failure;
-      retval = grub_fdt_set_prop32 (tmp_fdt, node, "linux,initrd-end",
-				    initrd_end);
+      retval = grub_fdt_edit_set_prop32 (edit, node, "linux,initrd-end",
+					 initrd_end);
       if (retval)
 	goto failure;
     }
 
-  /* Copy updated FDT to its launch location */
-  grub_memcpy (fdt_addr, tmp_fdt, tmp_size);
-  grub_free (tmp_fdt);
+  /* Write updated FDT to its launch location */
+  retval = grub_fdt_edit_commit (edit, fdt_addr, tmp_size);
+  if (retval)
+    goto failure;
+  grub_fdt_edit_free (edit);
 
   grub_dprintf ("loader", "FDT updated for Linux boot\n");
 
   return GRUB_ERR_NONE;
 
 failure:
-  grub_free (tmp_fdt);
+  grub_fdt_edit_free (edit);
   return grub_error (GRUB_ERR_BAD_ARGUMENT, "unable to prepare FDT");
 }
 
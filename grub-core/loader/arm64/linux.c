@@ -75,41 +75,61 @@ get_firmware_fdt (void)
   return firmware_fdt;
 }
 
-static void
+/* Index the user supplied or firmware device tree for editing, or an
+   empty one if there is neither.  */
+static grub_fdt_edit_t
 get_fdt (void)
 {
+  static struct grub_fdt_empty_tree empty_fdt;
   void *raw_fdt;
-  grub_size_t size;
-
-  if (fdt)
-    {
-      size = BYTES_TO_PAGES (grub_fdt_get_totalsize (fdt));
-      grub_efi_free_pages ((grub_efi_physical_address_t) fdt, size);
-    }
 
   if (loaded_fdt)
     raw_fdt = loaded_fdt;
   else
     raw_fdt = get_firmware_fdt();
 
-  size =
-    raw_fdt ? grub_fdt_get_totalsize (raw_fdt) : GRUB_FDT_EMPTY_TREE_SZ;
+  if (!raw_fdt)
+    {
+      grub_fdt_create_empty_tree (&empty_fdt, sizeof (empty_fdt));
+      raw_fdt = &empty_fdt;
+    }
+
+  if (grub_fdt_check_header_nosize (raw_fdt) != 0)
+    return NULL;
+
+  return grub_fdt_edit_begin (raw_fdt);
+}
+
+/* Write the edited tree to a new allocation. The old one is only freed
+   afterwards, the firmware table may still point at it and be the source
+   of the edits.  */
+static grub_err_t
+commit_fdt (grub_fdt_edit_t edit)
+{
+  grub_size_t size;
+  void *new_fdt;
+
+  size = grub_fdt_edit_get_size (edit);
   size += 0x400;
 
   grub_dprintf ("linux", "allocating %ld bytes for fdt\n", size);
-  fdt = grub_efi_allocate_pages (0, BYTES_TO_PAGES (size));
-  if (!fdt)
-    return;
+  new_fdt = grub_efi_allocate_pages (0, BYTES_TO_PAGES (size));
+  if (!new_fdt)
+    return GRUB_ERR_OUT_OF_MEMORY;
 
-  if (raw_fdt)
+  if (grub_fdt_edit_commit (edit, new_fdt, size) != 0)
     {
-      grub_memmove (fdt, raw_fdt, size);
-      grub_fdt_set_totalsize (fdt, size);
-    }
-  else
-    {
-      grub_fdt_create_empty_tree (fdt, size);
+      grub_efi_free_pages ((grub_efi_physical_address_t) new_fdt,
+			   BYTES_TO_PAGES (size));
+      return GRUB_ERR_BAD_OS;
     }
+
+  if (fdt)
+    grub_efi_free_pages ((grub_efi_physical_address_t) fdt,
+			 BYTES_TO_PAGES (grub_fdt_get_totalsize (fdt)));
+  fdt = new_fdt;
+
+  return GRUB_ERR_NONE;
 }
 
 static grub_err_t
@@ -135,15 +155,16 @@ finalize_params (void)
 {
   grub_efi_boot_services_t *b;
   grub_efi_status_t status;
+  grub_fdt_edit_t edit;
   int node, retval;
 
-  get_fdt ();
-  if (!fdt)
+  edit = get_fdt ();
+  if (!edit)
     goto failure;
 
-  node = grub_fdt_find_subnode (fdt, 0, "chosen");
+  node = grub_fdt_edit_find_subnode (edit, 0, "chosen");
   if (node < 0)
-    node = grub_fdt_add_subnode (fdt, 0, "chosen");
+    node = grub_fdt_edit_add_subnode (edit, 0, "chosen");
 
   if (node < 1)
     goto failure;
@@ -154,16 +175,22 @@ finalize_params (void)
       grub_dprintf ("linux", "Initrd @ 0x%012lx-0x%012lx\n",
 		    initrd_start, initrd_end);
 
-      retval = grub_fdt_set_prop64 (fdt, node, "linux,initrd-start",
-				    initrd_start);
+      retval = grub_fdt_edit_set_prop64 (edit, node, "linux,initrd-start",
+					 initrd_start);
       if (retval)
 	goto failure;
-      retval = grub_fdt_set_prop64 (fdt, node, "linux,initrd-end",
-				    initrd_end);
+      retval = grub_fdt_edit_set_prop64 (edit, node, "linux,initrd-end",
+					 initrd_end);
       if (retval)
 	goto failure;
     }
 
+  /* All edits are in, lay out the final tree in one go.  */
+  if (commit_fdt (edit) != GRUB_ERR_NONE)
+    goto failure;
+  grub_fdt_edit_free (edit);
+  edit = NULL;
+
   b = grub_efi_system_table->boot_services;
   status = b->install_configuration_table (&fdt_guid, fdt);
   if (status != GRUB_EFI_SUCCESS)
@@ -175,8 +202,10 @@ finalize_params (void)
   return GRUB_ERR_NONE;
 
 failure:
-  grub_efi_free_pages ((grub_efi_physical_address_t) fdt,
-		       BYTES_TO_PAGES (grub_fdt_get_totalsize (fdt)));
+  grub_fdt_edit_free (edit);
+  if (fdt)
+    grub_efi_free_pages ((grub_efi_physical_address_t) fdt,
+			 BYTES_TO_PAGES (grub_fdt_get_totalsize (fdt)));
   fdt = NULL;
   return grub_error(GRUB_ERR_BAD_OS, "failed to install/update FDT");
 }
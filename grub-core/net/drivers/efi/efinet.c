@@ -95,43 +95,52 @@ get_card_packet (struct grub_net_card *dev)
 {
   grub_efi_simple_network_t *net = dev->efi_net;
   grub_err_t err;
-  grub_efi_status_t st;
-  grub_efi_uintn_t bufsize = dev->rcvbufsize;
-  struct grub_net_buff *nb;
+  grub_efi_status_t st = GRUB_EFI_NOT_READY;
+  grub_efi_uintn_t bufsize;
+  struct grub_net_buff *nb = NULL;
   int i;
 
+  /* Frames are received straight into pool buffers, which go back to the
+     pool once the stack is done with them.  */
   for (i = 0; i < 2; i++)
     {
-      if (!dev->rcvbuf)
-	dev->rcvbuf = grub_malloc (dev->rcvbufsize);
-      if (!dev->rcvbuf)
+      if (!dev->rcvpool)
+	dev->rcvpool = grub_netbuff_pool_new (GRUB_NET_RCV_POOL_SIZE,
+					      dev->rcvbufsize + 2);
+      if (dev->rcvpool)
+	nb = grub_netbuff_pool_get (dev->rcvpool);
+      else
+	nb = grub_netbuff_alloc (dev->rcvbufsize + 2);
+      if (!nb)
 	return NULL;
 
+      /* Reserve 2 bytes so that 2 + 14/18 bytes of ethernet header is
+	 divisible by 4. So that IP header is aligned on 4 bytes. */
+      if (grub_netbuff_reserve (nb, 2))
+	{
+	  grub_netbuff_free (nb);
+	  return NULL;
+	}
+
+      bufsize = nb->end - nb->data;
       st = efi_call_7 (net->receive, net, NULL, &bufsize,
-		       dev->rcvbuf, NULL, NULL, NULL);
+		       nb->data, NULL, NULL, NULL);
       if (st != GRUB_EFI_BUFFER_TOO_SMALL)
 	break;
+      grub_netbuff_free (nb);
+      nb = NULL;
       dev->rcvbufsize = 2 * ALIGN_UP (dev->rcvbufsize > bufsize
 				      ? dev->rcvbufsize : bufsize, 64);
-      grub_free (dev->rcvbuf);
-      dev->rcvbuf = 0;
+      grub_netbuff_pool_destroy (dev->rcvpool);
+      dev->rcvpool = NULL;
     }
 
   if (st != GRUB_EFI_SUCCESS)
-    return NULL;
-
-  nb = grub_netbuff_alloc (bufsize + 2);
-  if (!nb)
-    return NULL;
-
-  /* Reserve 2 bytes so that 2 + 14/18 bytes of ethernet header is divisible
-     by 4. So that IP header is aligned on 4 bytes. */
-  if (grub_netbuff_reserve (nb, 2))
     {
       grub_netbuff_free (nb);
       return NULL;
     }
-  grub_memcpy (nb->data, dev->rcvbuf, bufsize);
+
   err = grub_netbuff_put (nb, bufsize);
   if (err)
     {
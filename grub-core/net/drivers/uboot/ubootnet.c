@@ -63,15 +63,22 @@ send_card_buffer (struct grub_net_card *dev, struct grub_net_buff *pack)
   return GRUB_ERR_NONE;
 }
 
+/* Wait up to TIMEOUT ms for a frame.  */
 static struct grub_net_buff *
-get_card_packet (struct grub_net_card *dev)
+receive_frame (struct grub_net_card *dev, grub_uint64_t timeout)
 {
   int rc;
   grub_uint64_t start_time;
   struct grub_net_buff *nb;
   int actual;
 
-  nb = grub_netbuff_alloc (dev->mtu + 64 + 2);
+  if (!dev->rcvpool)
+    dev->rcvpool = grub_netbuff_pool_new (GRUB_NET_RCV_POOL_SIZE,
+					  dev->mtu + 64 + 2);
+  if (dev->rcvpool)
+    nb = grub_netbuff_pool_get (dev->rcvpool);
+  else
+    nb = grub_netbuff_alloc (dev->mtu + 64 + 2);
   if (!nb)
     return NULL;
   /* Reserve 2 bytes so that 2 + 14/18 bytes of ethernet header is divisible
@@ -85,7 +92,7 @@ get_card_packet (struct grub_net_card *dev)
       grub_dprintf ("net", "rc=%d, actual=%d, time=%lld\n", rc, actual,
 		    grub_get_time_ms () - start_time);
     }
-  while ((actual <= 0 || rc < 0) && (grub_get_time_ms () - start_time < 200));
+  while ((actual <= 0 || rc < 0) && (grub_get_time_ms () - start_time < timeout));
   if (actual > 0)
     {
       grub_netbuff_put (nb, actual);
@@ -95,13 +102,37 @@ get_card_packet (struct grub_net_card *dev)
   return NULL;
 }
 
+static struct grub_net_buff *
+get_card_packet (struct grub_net_card *dev)
+{
+  return receive_frame (dev, 200);
+}
+
+/* Only the first frame is waited for; the rest of the batch is whatever
+   the device already has.  */
+static unsigned
+get_card_packets (struct grub_net_card *dev, struct grub_net_buff **bufs,
+		  unsigned max)
+{
+  unsigned n;
+
+  for (n = 0; n < max; n++)
+    {
+      bufs[n] = receive_frame (dev, n ? 0 : 200);
+      if (!bufs[n])
+	break;
+    }
+  return n;
+}
+
 static struct grub_net_card_driver ubootnet =
   {
     .name = "ubnet",
     .open = card_open,
     .close = card_close,
     .send = send_card_buffer,
-    .recv = get_card_packet
+    .recv = get_card_packet,
+    .recv_batch = get_card_packets
   };
 
 GRUB_MOD_INIT (ubootnet)
@@ -26,6 +26,7 @@
 #include <grub/dl.h>
 #include <grub/file.h>
 #include <grub/i18n.h>
+#include <grub/time.h>
 
 GRUB_MOD_LICENSE ("GPLv3+");
 
@@ -34,6 +35,35 @@ enum
     HTTP_PORT = 80
   };
 
+enum
+  {
+    /* Seeks are served with requests for at most this many bytes, so that
+       the connection stays usable for the next request.  */
+    HTTP_RANGE_SIZE = 4 << 20,
+    /* A forward seek within the response being received drops up to this
+       many bytes instead of sending a new request.  */
+    HTTP_SKIP_MAX = 1 << 20,
+    HTTP_MAX_IDLE_CONNS = 4,
+    /* Idle connections older than this are likely closed by the server.  */
+    HTTP_IDLE_TIMEOUT = 4000
+  };
+
+#define HTTP_RANGE_END_UNKNOWN ((grub_off_t) -1)
+
+/* A connection to a server, used by one file at a time and kept for the
+   next file or range request when the response came in completely.  */
+struct http_conn
+{
+  struct http_conn *next;
+  char *server;
+  /* NULL once closed or reset.  */
+  grub_net_tcp_socket_t sock;
+  /* The file the response is for, NULL while idle.  */
+  grub_file_t file;
+  grub_uint64_t last_used;
+};
+
+static struct http_conn *http_idle_conns;
 
 typedef struct http_data
 {
@@ -42,15 +72,32 @@ typedef struct http_data
   int headers_recv;
   int first_line_recv;
   int size_recv;
-  grub_net_tcp_socket_t sock;
+  struct http_conn *conn;
   char *filename;
   grub_err_t err;
   char *errmsg;
   int chunked;
   grub_size_t chunk_rem;
   int in_chunk_len;
+  /* The request has a Range header for [range_start, range_end).  */
+  int ranged;
+  grub_off_t range_start;
+  grub_off_t range_end;
+  /* Body bytes still to come if the response has a Content-Length.  */
+  int body_len_known;
+  grub_off_t body_rem;
+  /* Body bytes to drop before queuing the rest.  */
+  grub_off_t skip;
+  int keep_alive;
+  /* The whole response was received.  */
+  int done;
+  /* The next range needs a new connection.  */
+  int reconnect;
 } *http_data_t;
 
+static grub_err_t
+http_send_request (struct grub_file *file, grub_off_t offset, int initial);
+
 static grub_off_t
 have_ahead (struct grub_file *file)
 {
@@ -62,6 +109,130 @@ have_ahead (struct grub_file *file)
   return ret;
 }
 
+static void
+http_conn_abort (struct http_conn *conn)
+{
+  if (conn->sock)
+    grub_net_tcp_close (conn->sock, GRUB_NET_TCP_ABORT);
+  conn->sock = 0;
+}
+
+static void
+http_conn_free (struct http_conn *conn)
+{
+  http_conn_abort (conn);
+  grub_free (conn->server);
+  grub_free (conn);
+}
+
+static void http_err (grub_net_tcp_socket_t sock, void *c);
+static grub_err_t http_receive (grub_net_tcp_socket_t sock,
+				struct grub_net_buff *nb, void *c);
+
+/* An idle connection to SERVER if there is one, or a new one.  */
+static struct http_conn *
+http_conn_get (grub_file_t file, int *reused)
+{
+  const char *server = file->device->net->server;
+  struct http_conn *conn, **prev;
+  grub_uint64_t now = grub_get_time_ms ();
+
+  for (prev = &http_idle_conns; (conn = *prev); )
+    {
+      if (!conn->sock || now - conn->last_used > HTTP_IDLE_TIMEOUT)
+	{
+	  *prev = conn->next;
+	  http_conn_free (conn);
+	  continue;
+	}
+      if (grub_strcmp (conn->server, server) == 0)
+	{
+	  *prev = conn->next;
+	  conn->next = 0;
+	  conn->file = file;
+	  *reused = 1;
+	  return conn;
+	}
+      prev = &conn->next;
+    }
+
+  *reused = 0;
+  conn = grub_zalloc (sizeof (*conn));
+  if (!conn)
+    return NULL;
+  conn->server = grub_strdup (server);
+  if (!conn->server)
+    {
+      grub_free (conn);
+      return NULL;
+    }
+  conn->file = file;
+  conn->sock = grub_net_tcp_open (conn->server, HTTP_PORT, http_receive,
+				  http_err, http_err, conn);
+  if (!conn->sock)
+    {
+      grub_free (conn->server);
+      grub_free (conn);
+      return NULL;
+    }
+  return conn;
+}
+
+/* Keep CONN for a later request if its last response was complete.  */
+static void
+http_conn_put (struct http_conn *conn, int reusable)
+{
+  struct http_conn *c;
+  int count = 0;
+
+  conn->file = 0;
+  for (c = http_idle_conns; c; c = c->next)
+    count++;
+  if (!reusable || !conn->sock || count >= HTTP_MAX_IDLE_CONNS)
+    {
+      http_conn_free (conn);
+      return;
+    }
+  /* The file may have been closed with the socket stalled.  */
+  grub_net_tcp_unstall (conn->sock);
+  conn->last_used = grub_get_time_ms ();
+  conn->next = http_idle_conns;
+  http_idle_conns = conn;
+}
+
+static void
+http_set_eof (grub_file_t file)
+{
+  file->device->net->eof = 1;
+  file->device->net->stall = 1;
+  if (file->size == GRUB_FILE_SIZE_UNKNOWN)
+    file->size = have_ahead (file);
+}
+
+/* The body of the current response is complete. Ask for the next range
+   right away when reading in ranges. If the connection can't take it,
+   http_packets_pulled opens a new one, this runs from the TCP hooks.  */
+static void
+http_response_done (grub_file_t file, http_data_t data)
+{
+  data->done = 1;
+  if (data->err)
+    return;
+  if (data->ranged && data->range_end != HTTP_RANGE_END_UNKNOWN
+      && file->size != GRUB_FILE_SIZE_UNKNOWN
+      && data->range_end < file->size)
+    {
+      if (data->keep_alive && data->conn->sock
+	  && http_send_request (file, data->range_end, 0) == GRUB_ERR_NONE)
+	return;
+      grub_errno = GRUB_ERR_NONE;
+      data->reconnect = 1;
+      file->device->net->stall = 1;
+      return;
+    }
+  http_set_eof (file);
+}
+
 static grub_err_t
 parse_line (grub_file_t file, http_data_t data, char *ptr, grub_size_t len)
 {
@@ -79,14 +250,20 @@ parse_line (grub_file_t file, http_data_t data, char *ptr, grub_size_t len)
     {
       data->chunk_rem = grub_strtoul (ptr, 0, 16);
       grub_errno = GRUB_ERR_NONE;
+      /* The last chunk is followed by trailers up to an empty line.  */
       if (data->chunk_rem == 0)
+	data->in_chunk_len = 3;
+      else
+	data->in_chunk_len = 0;
+      return GRUB_ERR_NONE;
+    }
+  if (data->in_chunk_len == 3)
+    {
+      if (ptr == end)
 	{
-	  file->device->net->eof = 1;
-	  file->device->net->stall = 1;
-	  if (file->size == GRUB_FILE_SIZE_UNKNOWN)
-	    file->size = have_ahead (file);
+	  data->in_chunk_len = 0;
+	  http_response_done (file, data);
 	}
-      data->in_chunk_len = 0;
       return GRUB_ERR_NONE;
     }
   if (ptr == end)
@@ -94,6 +271,11 @@ parse_line (grub_file_t file, http_data_t data, char *ptr, grub_size_t len)
       data->headers_recv = 1;
       if (data->chunked)
 	data->in_chunk_len = 2;
+      else if (!data->body_len_known)
+	/* The body ends when the server closes.  */
+	data->keep_alive = 0;
+      else if (data->body_rem == 0)
+	http_response_done (file, data);
       return GRUB_ERR_NONE;
     }
 
@@ -110,9 +292,17 @@ parse_line (grub_file_t file, http_data_t data, char *ptr, grub_size_t len)
       code = grub_strtoul (ptr, &ptr, 10);
       if (grub_errno)
 	return grub_errno;
+      data->first_line_recv = 1;
       switch (code)
 	{
 	case 200:
+	  /* The server ignored the range and sends the whole file.  */
+	  if (data->ranged)
+	    {
+	      data->skip = data->range_start;
+	      data->ranged = 0;
+	    }
+	  break;
 	case 206:
 	  break;
 	case 404:
@@ -127,15 +317,32 @@ parse_line (grub_file_t file, http_data_t data, char *ptr, grub_size_t len)
 					 code, ptr);
 	  return GRUB_ERR_NONE;
 	}
-      data->first_line_recv = 1;
       return GRUB_ERR_NONE;
     }
   if (grub_memcmp (ptr, "Content-Length: ", sizeof ("Content-Length: ") - 1)
-      == 0 && !data->size_recv)
+      == 0)
     {
       ptr += sizeof ("Content-Length: ") - 1;
-      file->size = grub_strtoull (ptr, &ptr, 10);
-      data->size_recv = 1;
+      data->body_rem = grub_strtoull (ptr, &ptr, 10);
+      data->body_len_known = 1;
+      if (!data->size_recv && !data->ranged)
+	{
+	  file->size = data->body_rem;
+	  data->size_recv = 1;
+	}
+      return GRUB_ERR_NONE;
+    }
+  /* Content-Range: bytes FIRST-LAST/SIZE  */
+  if (grub_memcmp (ptr, "Content-Range: bytes ",
+		   sizeof ("Content-Range: bytes ") - 1) == 0)
+    {
+      ptr = grub_strchr (ptr, '/');
+      if (ptr && ptr[1] != '*' && !data->size_recv)
+	{
+	  file->size = grub_strtoull (ptr + 1, 0, 10);
+	  data->size_recv = 1;
+	}
+      grub_errno = GRUB_ERR_NONE;
       return GRUB_ERR_NONE;
     }
   if (grub_memcmp (ptr, "Transfer-Encoding: chunked",
@@ -144,47 +351,95 @@ parse_line (grub_file_t file, http_data_t data, char *ptr, grub_size_t len)
       data->chunked = 1;
       return GRUB_ERR_NONE;
     }
+  if (grub_memcmp (ptr, "Connection: close",
+		   sizeof ("Connection: close") - 1) == 0)
+    {
+      data->keep_alive = 0;
+      return GRUB_ERR_NONE;
+    }
 
   return GRUB_ERR_NONE;  
 }
 
 static void
 http_err (grub_net_tcp_socket_t sock __attribute__ ((unused)),
-	  void *f)
+	  void *c)
 {
-  grub_file_t file = f;
-  http_data_t data = file->data;
-
-  if (data->sock)
-    grub_net_tcp_close (data->sock, GRUB_NET_TCP_ABORT);
-  data->sock = 0;
+  struct http_conn *conn = c;
+  grub_file_t file = conn->file;
+  http_data_t data;
+
+  http_conn_abort (conn);
+  if (!file)
+    return;
+  data = file->data;
   if (data->current_line)
     grub_free (data->current_line);
   data->current_line = 0;
-  file->device->net->eof = 1;
-  file->device->net->stall = 1;
-  if (file->size == GRUB_FILE_SIZE_UNKNOWN)
-    file->size = have_ahead (file);
+  if (!data->done)
+    http_set_eof (file);
+}
+
+/* Queue body bytes for the reader.  */
+static void
+http_put_body (grub_file_t file, http_data_t data, struct grub_net_buff *nb)
+{
+  grub_net_t net = file->device->net;
+
+  if (data->skip)
+    {
+      grub_size_t n = nb->tail - nb->data;
+
+      if (n > data->skip)
+	n = data->skip;
+      data->skip -= n;
+      grub_netbuff_pull (nb, n);
+    }
+  if (nb->tail == nb->data)
+    {
+      grub_netbuff_free (nb);
+      return;
+    }
+
+  grub_net_put_packet (&net->packs, nb);
+  if (net->packs.count >= 20)
+    net->stall = 1;
+
+  if (net->packs.count >= 100)
+    grub_net_tcp_stall (data->conn->sock);
 }
 
 static grub_err_t
 http_receive (grub_net_tcp_socket_t sock __attribute__ ((unused)),
 	      struct grub_net_buff *nb,
-	      void *f)
+	      void *c)
 {
-  grub_file_t file = f;
-  http_data_t data = file->data;
+  struct http_conn *conn = c;
+  grub_file_t file = conn->file;
+  http_data_t data;
   grub_err_t err;
 
-  if (!data->sock)
+  /* Nothing is expected while idle.  */
+  if (!file)
     {
+      http_conn_abort (conn);
       grub_netbuff_free (nb);
       return GRUB_ERR_NONE;
     }
+  data = file->data;
 
   while (1)
     {
       char *ptr = (char *) nb->data;
+
+      if (!conn->sock || data->done)
+	{
+	  /* Data past the end of the response.  */
+	  data->keep_alive = 0;
+	  grub_netbuff_free (nb);
+	  return GRUB_ERR_NONE;
+	}
+
       if ((!data->headers_recv || data->in_chunk_len) && data->current_line)
 	{
 	  int have_line = 1;
@@ -202,7 +457,7 @@ http_receive (grub_net_tcp_socket_t sock __attribute__ ((unused)),
 	  if (!t)
 	    {
 	      grub_netbuff_free (nb);
-	      grub_net_tcp_close (data->sock, GRUB_NET_TCP_ABORT);
+	      http_conn_abort (conn);
 	      return grub_errno;
 	    }
 	      
@@ -215,21 +470,23 @@ http_receive (grub_net_tcp_socket_t sock __attribute__ ((unused)),
 	      grub_netbuff_free (nb);
 	      return GRUB_ERR_NONE;
 	    }
+	  /* Without the newline, parse_line terminates the line there.  */
 	  err = parse_line (file, data, data->current_line,
-			    data->current_line_len);
+			    data->current_line_len - 1);
 	  grub_free (data->current_line);
 	  data->current_line = 0;
 	  data->current_line_len = 0;
 	  if (err)
 	    {
-	      grub_net_tcp_close (data->sock, GRUB_NET_TCP_ABORT);
+	      http_conn_abort (conn);
 	      grub_netbuff_free (nb);
 	      return err;
 	    }
 	}
 
       while (ptr < (char *) nb->tail && (!data->headers_recv
-					 || data->in_chunk_len))
+					 || data->in_chunk_len)
+	     && !data->done)
 	{
 	  char *ptr2;
 	  ptr2 = grub_memchr (ptr, '\n', (char *) nb->tail - ptr);
@@ -239,7 +496,7 @@ http_receive (grub_net_tcp_socket_t sock __attribute__ ((unused)),
 	      if (!data->current_line)
 		{
 		  grub_netbuff_free (nb);
-		  grub_net_tcp_close (data->sock, GRUB_NET_TCP_ABORT);
+		  http_conn_abort (conn);
 		  return grub_errno;
 		}
 	      data->current_line_len = (char *) nb->tail - ptr;
@@ -250,13 +507,22 @@ http_receive (grub_net_tcp_socket_t sock __attribute__ ((unused)),
 	  err = parse_line (file, data, ptr, ptr2 - ptr);
 	  if (err)
 	    {
-	      grub_net_tcp_close (data->sock, GRUB_NET_TCP_ABORT);
+	      http_conn_abort (conn);
 	      grub_netbuff_free (nb);
 	      return err;
 	    }
 	  ptr = ptr2 + 1;
 	}
 
+      /* Don't take an error page for the file.  */
+      if (data->headers_recv && data->err)
+	{
+	  http_conn_abort (conn);
+	  http_set_eof (file);
+	  grub_netbuff_free (nb);
+	  return GRUB_ERR_NONE;
+	}
+
       if (((char *) nb->tail - ptr) <= 0)
 	{
 	  grub_netbuff_free (nb);
@@ -265,22 +531,36 @@ http_receive (grub_net_tcp_socket_t sock __attribute__ ((unused)),
       err = grub_netbuff_pull (nb, ptr - (char *) nb->data);
       if (err)
 	{
-	  grub_net_tcp_close (data->sock, GRUB_NET_TCP_ABORT);
+	  http_conn_abort (conn);
 	  grub_netbuff_free (nb);
 	  return err;
 	}
-      if (!(data->chunked && (grub_ssize_t) data->chunk_rem
-	    < nb->tail - nb->data))
-	{
-	  grub_net_put_packet (&file->device->net->packs, nb);
-	  if (file->device->net->packs.count >= 20)
-	    file->device->net->stall = 1;
+      /* The next response only comes after the next request.  */
+      if (data->done)
+	continue;
 
-	  if (file->device->net->packs.count >= 100)
-	    grub_net_tcp_stall (data->sock);
+      if (!data->chunked)
+	{
+	  if (data->body_len_known)
+	    {
+	      if ((grub_off_t) (nb->tail - nb->data) > data->body_rem)
+		{
+		  data->keep_alive = 0;
+		  grub_netbuff_unput (nb, (nb->tail - nb->data)
+				      - data->body_rem);
+		}
+	      data->body_rem -= nb->tail - nb->data;
+	    }
+	  http_put_body (file, data, nb);
+	  if (data->body_len_known && !data->body_rem)
+	    http_response_done (file, data);
+	  return GRUB_ERR_NONE;
+	}
 
-	  if (data->chunked)
-	    data->chunk_rem -= nb->tail - nb->data;
+      if ((grub_ssize_t) data->chunk_rem >= nb->tail - nb->data)
+	{
+	  data->chunk_rem -= nb->tail - nb->data;
+	  http_put_body (file, data, nb);
 	  return GRUB_ERR_NONE;
 	}
       if (data->chunk_rem)
@@ -291,134 +571,146 @@ http_receive (grub_net_tcp_socket_t sock __attribute__ ((unused)),
 	    return grub_errno;
 	  grub_netbuff_put (nb2, data->chunk_rem);
 	  grub_memcpy (nb2->data, nb->data, data->chunk_rem);
-	  if (file->device->net->packs.count >= 20)
-	    {
-	      file->device->net->stall = 1;
-	      grub_net_tcp_stall (data->sock);
-	    }
-
-	  grub_net_put_packet (&file->device->net->packs, nb2);
+	  http_put_body (file, data, nb2);
 	  grub_netbuff_pull (nb, data->chunk_rem);
 	}
       data->in_chunk_len = 1;
     }
 }
 
+/* Send a GET for the file from OFFSET on. INITIAL asks for the whole file,
+   otherwise for a range of at most HTTP_RANGE_SIZE if the size is known.  */
 static grub_err_t
-http_establish (struct grub_file *file, grub_off_t offset, int initial)
+http_send_request (struct grub_file *file, grub_off_t offset, int initial)
 {
   http_data_t data = file->data;
-  grub_uint8_t *ptr;
-  int i;
   struct grub_net_buff *nb;
+  grub_size_t len;
   grub_err_t err;
 
-  nb = grub_netbuff_alloc (GRUB_NET_TCP_RESERVE_SIZE
-			   + sizeof ("GET ") - 1
-			   + grub_strlen (data->filename)
-			   + sizeof (" HTTP/1.1\r\nHost: ") - 1
-			   + grub_strlen (file->device->net->server)
-			   + sizeof ("\r\nUser-Agent: " PACKAGE_STRING
-				     "\r\n") - 1
-			   + sizeof ("Range: bytes=XXXXXXXXXXXXXXXXXXXX"
-				     "-\r\n\r\n"));
+  data->headers_recv = 0;
+  data->first_line_recv = 0;
+  data->chunked = 0;
+  data->chunk_rem = 0;
+  data->in_chunk_len = 0;
+  data->body_len_known = 0;
+  data->body_rem = 0;
+  data->skip = 0;
+  data->keep_alive = 1;
+  data->done = 0;
+  data->reconnect = 0;
+  data->err = GRUB_ERR_NONE;
+  grub_free (data->errmsg);
+  data->errmsg = 0;
+
+  data->ranged = !initial;
+  data->range_start = offset;
+  data->range_end = HTTP_RANGE_END_UNKNOWN;
+  if (data->ranged && file->size != GRUB_FILE_SIZE_UNKNOWN)
+    data->range_end = (file->size - offset > HTTP_RANGE_SIZE
+		       ? offset + HTTP_RANGE_SIZE : file->size);
+
+  len = (sizeof ("GET ") - 1
+	 + grub_strlen (data->filename)
+	 + sizeof (" HTTP/1.1\r\nHost: ") - 1
+	 + grub_strlen (file->device->net->server)
+	 + sizeof ("\r\nUser-Agent: " PACKAGE_STRING "\r\n") - 1
+	 + sizeof ("Range: bytes=XXXXXXXXXXXXXXXXXXXX-XXXXXXXXXXXXXXXXXXXX"
+		   "\r\n\r\n"));
+  nb = grub_netbuff_alloc (GRUB_NET_TCP_RESERVE_SIZE + len);
   if (!nb)
     return grub_errno;
 
   grub_netbuff_reserve (nb, GRUB_NET_TCP_RESERVE_SIZE);
-  ptr = nb->tail;
-  err = grub_netbuff_put (nb, sizeof ("GET ") - 1);
+  if (!data->ranged)
+    grub_snprintf ((char *) nb->tail, len,
+		   "GET %s HTTP/1.1\r\nHost: %s\r\n"
+		   "User-Agent: " PACKAGE_STRING "\r\n\r\n",
+		   data->filename, file->device->net->server);
+  else if (data->range_end == HTTP_RANGE_END_UNKNOWN)
+    grub_snprintf ((char *) nb->tail, len,
+		   "GET %s HTTP/1.1\r\nHost: %s\r\n"
+		   "User-Agent: " PACKAGE_STRING "\r\n"
+		   "Range: bytes=%" PRIuGRUB_UINT64_T "-\r\n\r\n",
+		   data->filename, file->device->net->server, offset);
+  else
+    grub_snprintf ((char *) nb->tail, len,
+		   "GET %s HTTP/1.1\r\nHost: %s\r\n"
+		   "User-Agent: " PACKAGE_STRING "\r\n"
+		   "Range: bytes=%" PRIuGRUB_UINT64_T "-%" PRIuGRUB_UINT64_T
+		   "\r\n\r\n",
+		   data->filename, file->device->net->server, offset,
+		   data->range_end - 1);
+  err = grub_netbuff_put (nb, grub_strlen ((char *) nb->tail));
   if (err)
     {
       grub_netbuff_free (nb);
       return err;
     }
-  grub_memcpy (ptr, "GET ", sizeof ("GET ") - 1);
 
-  ptr = nb->tail;
-
-  err = grub_netbuff_put (nb, grub_strlen (data->filename));
+  err = grub_net_send_tcp_packet (data->conn->sock, nb, 1);
   if (err)
-    {
-      grub_netbuff_free (nb);
-      return err;
-    }
-  grub_memcpy (ptr, data->filename, grub_strlen (data->filename));
+    grub_netbuff_free (nb);
+  return err;
+}
 
-  ptr = nb->tail;
-  err = grub_netbuff_put (nb, sizeof (" HTTP/1.1\r\nHost: ") - 1);
-  if (err)
-    {
-      grub_netbuff_free (nb);
-      return err;
-    }
-  grub_memcpy (ptr, " HTTP/1.1\r\nHost: ",
-	       sizeof (" HTTP/1.1\r\nHost: ") - 1);
+static grub_err_t
+http_establish (struct grub_file *file, grub_off_t offset, int initial)
+{
+  http_data_t data = file->data;
+  int i, try;
+  grub_err_t err;
 
-  ptr = nb->tail;
-  err = grub_netbuff_put (nb, grub_strlen (file->device->net->server));
-  if (err)
+  for (try = 0; ; try++)
     {
-      grub_netbuff_free (nb);
-      return err;
-    }
-  grub_memcpy (ptr, file->device->net->server,
-	       grub_strlen (file->device->net->server));
+      int reused = 1, dropped = 0;
 
-  ptr = nb->tail;
-  err = grub_netbuff_put (nb, 
-			  sizeof ("\r\nUser-Agent: " PACKAGE_STRING "\r\n")
-			  - 1);
-  if (err)
-    {
-      grub_netbuff_free (nb);
-      return err;
-    }
-  grub_memcpy (ptr, "\r\nUser-Agent: " PACKAGE_STRING "\r\n",
-	       sizeof ("\r\nUser-Agent: " PACKAGE_STRING "\r\n") - 1);
-  if (!initial)
-    {
-      ptr = nb->tail;
-      grub_snprintf ((char *) ptr,
-		     sizeof ("Range: bytes=XXXXXXXXXXXXXXXXXXXX-"
-			     "\r\n"
-			     "\r\n"),
-		     "Range: bytes=%" PRIuGRUB_UINT64_T "-\r\n\r\n",
-		     offset);
-      grub_netbuff_put (nb, grub_strlen ((char *) ptr));
-    }
-  ptr = nb->tail;
-  grub_netbuff_put (nb, 2);
-  grub_memcpy (ptr, "\r\n", 2);
-
-  data->sock = grub_net_tcp_open (file->device->net->server,
-				  HTTP_PORT, http_receive,
-				  http_err, http_err,
-				  file);
-  if (!data->sock)
-    {
-      grub_netbuff_free (nb);
-      return grub_errno;
-    }
+      file->device->net->eof = 0;
+      file->device->net->stall = 0;
+      if (!data->size_recv)
+	file->size = GRUB_FILE_SIZE_UNKNOWN;
 
-  //  grub_net_poll_cards (5000);
+      /* A connection the server closed since its last response.  */
+      if (data->conn && !data->conn->sock)
+	{
+	  http_conn_free (data->conn);
+	  data->conn = 0;
+	  dropped = 1;
+	}
+      if (!data->conn)
+	{
+	  data->conn = http_conn_get (file, &reused);
+	  if (!data->conn)
+	    return grub_errno;
+	  /* Retry as for a kept connection.  */
+	  reused |= dropped;
+	}
 
-  err = grub_net_send_tcp_packet (data->sock, nb, 1);
-  if (err)
-    {
-      grub_net_tcp_close (data->sock, GRUB_NET_TCP_ABORT);
-      return err;
-    }
+      err = http_send_request (file, offset, initial);
+      if (err == GRUB_ERR_NONE)
+	for (i = 0; !data->headers_recv && data->conn->sock && i < 100; i++)
+	  {
+	    grub_net_tcp_retransmit ();
+	    grub_net_poll_cards (300, &data->headers_recv);
+	  }
 
-  for (i = 0; !data->headers_recv && i < 100; i++)
-    {
-      grub_net_tcp_retransmit ();
-      grub_net_poll_cards (300, &data->headers_recv);
-    }
+      if (data->headers_recv)
+	break;
 
-  if (!data->headers_recv)
-    {
-      grub_net_tcp_close (data->sock, GRUB_NET_TCP_ABORT);
+      /* The server may have closed a kept connection meanwhile, try once
+	 more on a new one.  */
+      if (reused && try == 0 && !data->first_line_recv && !data->err)
+	{
+	  http_conn_free (data->conn);
+	  data->conn = 0;
+	  grub_errno = GRUB_ERR_NONE;
+	  continue;
+	}
+
+      http_conn_free (data->conn);
+      data->conn = 0;
+      if (err)
+	return err;
       if (data->err)
 	{
 	  char *str = data->errmsg;
@@ -429,44 +721,66 @@ http_establish (struct grub_file *file, grub_off_t offset, int initial)
 	}
       return grub_error (GRUB_ERR_TIMEOUT, N_("time out opening `%s'"), data->filename);
     }
+
+  if (data->err)
+    {
+      char *str = data->errmsg;
+      http_conn_free (data->conn);
+      data->conn = 0;
+      err = grub_error (data->err, "%s", str);
+      grub_free (str);
+      data->errmsg = 0;
+      return err;
+    }
   return GRUB_ERR_NONE;
 }
 
 static grub_err_t
 http_seek (struct grub_file *file, grub_off_t off)
 {
-  struct http_data *old_data, *data;
+  http_data_t data = file->data;
+  grub_net_t net = file->device->net;
+  grub_off_t ahead = have_ahead (file);
   grub_err_t err;
-  old_data = file->data;
-  /* FIXME: Reuse socket?  */
-  if (old_data->sock)
-    grub_net_tcp_close (old_data->sock, GRUB_NET_TCP_ABORT);
-  old_data->sock = 0;
 
-  while (file->device->net->packs.first)
+  /* Close enough ahead in the response being received: drop the bytes up
+     to OFF as they come.  */
+  if (data->conn && data->conn->sock && data->headers_recv && !data->done
+      && !data->err && off >= ahead && off - ahead <= HTTP_SKIP_MAX
+      && (!data->ranged || data->range_end == HTTP_RANGE_END_UNKNOWN
+	  || off <= data->range_end))
+    data->skip += off - ahead;
+  else if (data->conn
+	   && (!data->conn->sock || !data->done || !data->keep_alive))
     {
-      grub_netbuff_free (file->device->net->packs.first->nb);
-      grub_net_remove_packet (file->device->net->packs.first);
+      /* Closed by the server, or the rest of the response can't be told
+	 from the next one.  */
+      http_conn_free (data->conn);
+      data->conn = 0;
     }
 
-  file->device->net->stall = 0;
-  file->device->net->offset = off;
-
-  data = grub_zalloc (sizeof (*data));
-  if (!data)
-    return grub_errno;
+  while (net->packs.first)
+    {
+      grub_netbuff_free (net->packs.first->nb);
+      grub_net_remove_packet (net->packs.first);
+    }
+  net->offset = off;
+  net->stall = 0;
+  /* The seek replaces any pending continuation of a ranged read.  */
+  data->reconnect = 0;
+  if (data->conn && data->conn->sock)
+    grub_net_tcp_unstall (data->conn->sock);
+
+  if (data->conn && !data->done)
+    return GRUB_ERR_NONE;
 
-  data->size_recv = 1;
-  data->filename = old_data->filename;
-  if (!data->filename)
+  if (file->size != GRUB_FILE_SIZE_UNKNOWN && off >= file->size)
     {
-      grub_free (data);
-      file->data = 0;
-      return grub_errno;
+      net->eof = 1;
+      net->stall = 1;
+      return GRUB_ERR_NONE;
     }
-  grub_free (old_data);
 
-  file->data = data;
   err = http_establish (file, off, 0);
   if (err)
     {
@@ -518,10 +832,12 @@ http_close (struct grub_file *file)
   if (!data)
     return GRUB_ERR_NONE;
 
-  if (data->sock)
-    grub_net_tcp_close (data->sock, GRUB_NET_TCP_ABORT);
+  if (data->conn)
+    http_conn_put (data->conn, data->done && data->keep_alive
+		   && !data->err && !data->current_line);
   if (data->current_line)
     grub_free (data->current_line);
+  grub_free (data->errmsg);
   grub_free (data->filename);
   grub_free (data);
   return GRUB_ERR_NONE;
@@ -535,10 +851,26 @@ http_packets_pulled (struct grub_file *file)
   if (file->device->net->packs.count >= 20)
     return 0;
 
+  if (data && data->reconnect)
+    {
+      grub_off_t off = data->range_end;
+      grub_err_t err;
+
+      data->reconnect = 0;
+      http_conn_free (data->conn);
+      data->conn = 0;
+      err = http_establish (file, off, 0);
+      if (err)
+	{
+	  http_set_eof (file);
+	  return err;
+	}
+    }
+
   if (!file->device->net->eof)
     file->device->net->stall = 0;
-  if (data && data->sock)
-    grub_net_tcp_unstall (data->sock);
+  if (data && data->conn && data->conn->sock)
+    grub_net_tcp_unstall (data->conn->sock);
   return 0;
 }
 
@@ -558,5 +890,13 @@ GRUB_MOD_INIT (http)
 
 GRUB_MOD_FINI (http)
 {
+  struct http_conn *conn, *next;
+
+  for (conn = http_idle_conns; conn; conn = next)
+    {
+      next = conn->next;
+      http_conn_free (conn);
+    }
+  http_idle_conns = 0;
   grub_net_app_level_unregister (&grub_http_protocol);
 }
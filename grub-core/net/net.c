@@ -207,6 +207,8 @@ grub_net_card_unregister (struct grub_net_card *card)
 	card->driver->close (card);
       card->opened = 0;
     }
+  grub_netbuff_pool_destroy (card->rcvpool);
+  card->rcvpool = NULL;
   grub_list_remove (GRUB_AS_LIST (card));
 }
 
@@ -1437,12 +1439,33 @@ grub_net_fs_close (grub_file_t file)
   return GRUB_ERR_NONE;
 }
 
-static void
+/* Frames taken from a driver per call.  */
+#define RECV_BATCH 16
+
+static unsigned
+recv_frames (struct grub_net_card *card, struct grub_net_buff **bufs,
+	     unsigned max)
+{
+  unsigned n;
+
+  if (card->driver->recv_batch)
+    return card->driver->recv_batch (card, bufs, max);
+
+  for (n = 0; n < max; n++)
+    {
+      bufs[n] = card->driver->recv (card);
+      if (!bufs[n])
+	break;
+    }
+  return n;
+}
+
+static int
 receive_packets (struct grub_net_card *card, int *stop_condition)
 {
   int received = 0;
   if (card->num_ifaces == 0)
-    return;
+    return 0;
   if (!card->opened)
     {
       grub_err_t err = GRUB_ERR_NONE;
@@ -1451,35 +1474,41 @@ receive_packets (struct grub_net_card *card, int *stop_condition)
       if (err)
 	{
 	  grub_errno = GRUB_ERR_NONE;
-	  return;
+	  return 0;
 	}
       card->opened = 1;
     }
   while (received < 100)
     {
-      /* Maybe should be better have a fixed number of packets for each card
-	 and just mark them as used and not used.  */ 
-      struct grub_net_buff *nb;
+      struct grub_net_buff *batch[RECV_BATCH];
+      unsigned n, i;
 
       if (received > 10 && stop_condition && *stop_condition)
 	break;
 
-      nb = card->driver->recv (card);
-      if (!nb)
+      n = recv_frames (card, batch, ARRAY_SIZE (batch));
+      for (i = 0; i < n; i++)
 	{
-	  card->last_poll = grub_get_time_ms ();
-	  break;
+	  grub_net_recv_ethernet_packet (batch[i], card);
+	  if (grub_errno)
+	    {
+	      grub_dprintf ("net", "error receiving: %d: %s\n", grub_errno,
+			    grub_errmsg);
+	      grub_errno = GRUB_ERR_NONE;
+	    }
 	}
-      received++;
-      grub_net_recv_ethernet_packet (nb, card);
-      if (grub_errno)
+      received += n;
+      if (n < ARRAY_SIZE (batch))
 	{
-	  grub_dprintf ("net", "error receiving: %d: %s\n", grub_errno,
-			grub_errmsg);
-	  grub_errno = GRUB_ERR_NONE;
+	  card->last_poll = grub_get_time_ms ();
+	  break;
 	}
     }
+  /* One cumulative ACK for the whole burst.  */
+  if (received)
+    grub_net_tcp_flush_acks ();
   grub_print_error ();
+  return received;
 }
 
 static char *
@@ -1520,19 +1549,59 @@ grub_env_set_net_property (const char *intername, const char *suffix,
   return ret;
 }
 
-void
-grub_net_poll_cards (unsigned time, int *stop_condition)
+/* Cards are polled back to back while frames arrive and for
+   POLL_SPIN_MS after the last one. Once the link is idle the gap between
+   polls doubles up to POLL_MAX_BACKOFF_MS, idling the CPU meanwhile.  */
+#define POLL_SPIN_MS 2
+#define POLL_MAX_BACKOFF_MS 8
+
+/* Poll until TIME ms pass or *STOP_CONDITION is set. If NET is given, also
+   return as soon as a burst of frames has left data queued on it.  */
+static void
+poll_cards (unsigned time, int *stop_condition, grub_net_t net)
 {
   struct grub_net_card *card;
-  grub_uint64_t start_time;
-  start_time = grub_get_time_ms ();
+  grub_uint64_t start_time, last_rx, now, until;
+  unsigned backoff = 0;
+
+  start_time = last_rx = grub_get_time_ms ();
   while ((grub_get_time_ms () - start_time) < time
 	 && (!stop_condition || !*stop_condition))
-    FOR_NET_CARDS (card)
-      receive_packets (card, stop_condition);
+    {
+      int received = 0;
+
+      FOR_NET_CARDS (card)
+	received += receive_packets (card, stop_condition);
+      now = grub_get_time_ms ();
+      if (received)
+	{
+	  last_rx = now;
+	  backoff = 0;
+	  continue;
+	}
+      if (net && (net->packs.first || net->eof))
+	break;
+      if (now - last_rx < POLL_SPIN_MS)
+	continue;
+
+      backoff = backoff ? backoff * 2 : 1;
+      if (backoff > POLL_MAX_BACKOFF_MS)
+	backoff = POLL_MAX_BACKOFF_MS;
+      until = now + backoff;
+      if (until > start_time + time)
+	until = start_time + time;
+      while (grub_get_time_ms () < until)
+	grub_cpu_idle ();
+    }
   grub_net_tcp_retransmit ();
 }
 
+void
+grub_net_poll_cards (unsigned time, int *stop_condition)
+{
+  poll_cards (time, stop_condition, NULL);
+}
+
 static void
 grub_net_poll_cards_idle_real (void)
 {
@@ -1598,8 +1667,8 @@ grub_net_fs_read_real (grub_file_t file, char *buf, grub_size_t len)
       if (!net->eof)
 	{
 	  try++;
-	  grub_net_poll_cards (GRUB_NET_INTERVAL +
-                               (try * GRUB_NET_INTERVAL_ADDITION), &net->stall);
+	  poll_cards (GRUB_NET_INTERVAL + (try * GRUB_NET_INTERVAL_ADDITION),
+		      &net->stall, net);
         }
       else
 	return total;
@@ -94,6 +94,8 @@ grub_netbuff_alloc (grub_size_t len)
 				 + len / sizeof (grub_properly_aligned_t));
   nb->head = nb->data = nb->tail = data;
   nb->end = (grub_uint8_t *) nb;
+  nb->pool = NULL;
+  nb->next_free = NULL;
   return nb;
 }
 
@@ -122,9 +124,103 @@ grub_netbuff_free (struct grub_net_buff *nb)
 {
   if (!nb)
     return;
+  if (nb->pool)
+    {
+      struct grub_net_buff_pool *pool = nb->pool;
+
+      pool->in_use--;
+      if (!pool->destroyed && pool->n_free < pool->max_free)
+	{
+	  nb->next_free = pool->free;
+	  pool->free = nb;
+	  pool->n_free++;
+	  return;
+	}
+      grub_free (nb->head);
+      if (pool->destroyed && !pool->in_use)
+	grub_free (pool);
+      return;
+    }
   grub_free (nb->head);
 }
 
+struct grub_net_buff_pool *
+grub_netbuff_pool_new (unsigned count, grub_size_t len)
+{
+  struct grub_net_buff_pool *pool;
+  unsigned i;
+
+  pool = grub_zalloc (sizeof (*pool));
+  if (!pool)
+    return NULL;
+  pool->buf_size = len;
+  pool->max_free = count;
+
+  for (i = 0; i < count; i++)
+    {
+      struct grub_net_buff *nb;
+
+      nb = grub_netbuff_alloc (len);
+      if (!nb)
+	{
+	  grub_netbuff_pool_destroy (pool);
+	  return NULL;
+	}
+      nb->pool = pool;
+      nb->next_free = pool->free;
+      pool->free = nb;
+      pool->n_free++;
+    }
+  return pool;
+}
+
+/* An empty buffer of the pool's size. When all are in use, e.g. while a
+   protocol queues out-of-order data, a new one is allocated and kept on
+   return as long as there are fewer than MAX_FREE idle ones.  */
+struct grub_net_buff *
+grub_netbuff_pool_get (struct grub_net_buff_pool *pool)
+{
+  struct grub_net_buff *nb;
+
+  nb = pool->free;
+  if (nb)
+    {
+      pool->free = nb->next_free;
+      pool->n_free--;
+      nb->data = nb->tail = nb->head;
+    }
+  else
+    {
+      nb = grub_netbuff_alloc (pool->buf_size);
+      if (!nb)
+	return NULL;
+      nb->pool = pool;
+    }
+  nb->next_free = NULL;
+  pool->in_use++;
+  return nb;
+}
+
+/* Buffers still in use are freed when they come back.  */
+void
+grub_netbuff_pool_destroy (struct grub_net_buff_pool *pool)
+{
+  struct grub_net_buff *nb, *next;
+
+  if (!pool)
+    return;
+  for (nb = pool->free; nb; nb = next)
+    {
+      next = nb->next_free;
+      grub_free (nb->head);
+    }
+  pool->free = NULL;
+  pool->n_free = 0;
+  pool->destroyed = 1;
+  if (!pool->in_use)
+    grub_free (pool);
+}
+
 grub_err_t
 grub_netbuff_clear (struct grub_net_buff *nb)
 {
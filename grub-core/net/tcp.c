@@ -22,12 +22,28 @@
 #include <grub/net/netbuff.h>
 #include <grub/time.h>
 #include <grub/priority_queue.h>
+#include <grub/mm_private.h>
 
 #define TCP_SYN_RETRANSMISSION_TIMEOUT GRUB_NET_INTERVAL
 #define TCP_SYN_RETRANSMISSION_COUNT GRUB_NET_TRIES
 #define TCP_RETRANSMISSION_TIMEOUT GRUB_NET_INTERVAL
 #define TCP_RETRANSMISSION_COUNT GRUB_NET_TRIES
 
+/* The receive window is this share of the heap, within the limits below.  */
+#define TCP_WINDOW_HEAP_SHARE 64
+#define TCP_MIN_WINDOW 8192
+#define TCP_MAX_WINDOW (4 << 20)
+/* RFC 7323 limit.  */
+#define TCP_MAX_WINDOW_SCALE 14
+
+/* In-order segments are acknowledged together once the card has no more
+   frames queued, or after this many.  */
+#define TCP_DELAYED_ACK_SEGMENTS 8
+
+/* Sequence number comparisons modulo 2^32.  */
+#define TCP_SEQ_LT(a, b) ((grub_int32_t) ((a) - (b)) < 0)
+#define TCP_SEQ_GT(a, b) ((grub_int32_t) ((a) - (b)) > 0)
+
 struct unacked
 {
   struct unacked *next;
@@ -47,6 +63,17 @@ enum
     TCP_URG = 0x20,
   };
 
+enum
+  {
+    TCP_OPT_EOL = 0,
+    TCP_OPT_NOP = 1,
+    TCP_OPT_MSS = 2,
+    TCP_OPT_WINDOW_SCALE = 3,
+  };
+
+/* MSS, NOP and window scale, in that order.  */
+#define TCP_SYN_OPTIONS_SIZE 8
+
 struct grub_net_tcp_socket
 {
   struct grub_net_tcp_socket *next;
@@ -65,7 +92,11 @@ struct grub_net_tcp_socket
   grub_uint32_t my_cur_seq;
   grub_uint32_t their_start_seq;
   grub_uint32_t their_cur_seq;
-  grub_uint16_t my_window;
+  /* In bytes, advertised shifted right by my_window_scale.  */
+  grub_uint32_t my_window;
+  int my_window_scale;
+  /* In-order segments received since our last ACK.  */
+  int ack_pending;
   struct unacked *unack_first;
   struct unacked *unack_last;
   grub_err_t (*recv_hook) (grub_net_tcp_socket_t sock, struct grub_net_buff *nb,
@@ -163,6 +194,110 @@ tcp_socket_register (grub_net_tcp_socket_t sock)
 		  GRUB_AS_LIST (sock));
 }
 
+/* Size the receive window from the heap, like the disk cache, and pick the
+   smallest window scale that can advertise it.  */
+static void
+tcp_init_window (grub_net_tcp_socket_t sock)
+{
+  grub_size_t heap_size = 0;
+  grub_uint32_t window;
+  int scale = 0;
+
+#if !defined (GRUB_UTIL) && !defined (GRUB_MACHINE_EMU)
+  grub_mm_region_t r;
+
+  for (r = grub_mm_base; r; r = r->next)
+    heap_size += r->size;
+#endif
+
+  if (heap_size / TCP_WINDOW_HEAP_SHARE > TCP_MAX_WINDOW)
+    window = TCP_MAX_WINDOW;
+  else if (heap_size / TCP_WINDOW_HEAP_SHARE < TCP_MIN_WINDOW)
+    window = TCP_MIN_WINDOW;
+  else
+    window = heap_size / TCP_WINDOW_HEAP_SHARE;
+
+  while ((window >> scale) > 0xffff && scale < TCP_MAX_WINDOW_SCALE)
+    scale++;
+
+  sock->my_window = window & ~((1U << scale) - 1);
+  sock->my_window_scale = scale;
+}
+
+/* Called when the peer's SYN has no window scale option.  */
+static void
+tcp_disable_window_scale (grub_net_tcp_socket_t sock)
+{
+  sock->my_window_scale = 0;
+  if (sock->my_window > 0xffff)
+    sock->my_window = 0xffff;
+}
+
+/* Window field of our segments, big endian.  */
+static grub_uint16_t
+tcp_window_field (grub_net_tcp_socket_t sock)
+{
+  if (sock->i_stall)
+    return 0;
+  return grub_cpu_to_be16 (sock->my_window >> sock->my_window_scale);
+}
+
+/* Options of our SYN: the MSS, so that peers don't fall back to 536 bytes,
+   and our window scale unless the peer's SYN came without one.  */
+static void
+tcp_fill_syn_options (grub_net_tcp_socket_t sock, grub_uint8_t *opt,
+		      int window_scale)
+{
+  grub_size_t mss = sock->inf->card->mtu - sizeof (struct tcphdr);
+
+  if (sock->out_nla.type == GRUB_NET_NETWORK_LEVEL_PROTOCOL_IPV4)
+    mss -= GRUB_NET_OUR_IPV4_HEADER_SIZE;
+  else
+    mss -= GRUB_NET_OUR_IPV6_HEADER_SIZE;
+  if (mss > 0xffff)
+    mss = 0xffff;
+
+  opt[0] = TCP_OPT_MSS;
+  opt[1] = 4;
+  opt[2] = mss >> 8;
+  opt[3] = mss & 0xff;
+  opt[4] = TCP_OPT_NOP;
+  if (window_scale)
+    {
+      opt[5] = TCP_OPT_WINDOW_SCALE;
+      opt[6] = 3;
+      opt[7] = sock->my_window_scale;
+    }
+  else
+    opt[5] = opt[6] = opt[7] = TCP_OPT_NOP;
+}
+
+/* Whether the options of SYN segment TCPH include a window scale.  */
+static int
+tcp_syn_has_window_scale (const struct tcphdr *tcph)
+{
+  const grub_uint8_t *opt = (const grub_uint8_t *) (tcph + 1);
+  const grub_uint8_t *end = (const grub_uint8_t *) tcph
+    + (grub_be_to_cpu16 (tcph->flags) >> 12) * sizeof (grub_uint32_t);
+
+  while (opt < end)
+    {
+      if (*opt == TCP_OPT_EOL)
+	break;
+      if (*opt == TCP_OPT_NOP)
+	{
+	  opt++;
+	  continue;
+	}
+      if (end - opt < 2 || opt[1] < 2 || end - opt < opt[1])
+	break;
+      if (*opt == TCP_OPT_WINDOW_SCALE && opt[1] == 3)
+	return 1;
+      opt += opt[1];
+    }
+  return 0;
+}
+
 static void
 error (grub_net_tcp_socket_t sock)
 {
@@ -194,6 +329,8 @@ tcp_send (struct grub_net_buff *nb, grub_net_tcp_socket_t socket)
   tcph = (struct tcphdr *) nb->data;
 
   tcph->seqnr = grub_cpu_to_be32 (socket->my_cur_seq);
+  if (tcph->flags & grub_cpu_to_be16_compile_time (TCP_ACK))
+    socket->ack_pending = 0;
   size = (nb->tail - nb->data - (grub_be_to_cpu16 (tcph->flags) >> 12) * 4);
   if (grub_be_to_cpu16 (tcph->flags) & TCP_FIN)
     size++;
@@ -332,8 +469,7 @@ ack_real (grub_net_tcp_socket_t sock, int res)
     {
       tcph_ack->ack = grub_cpu_to_be32 (sock->their_cur_seq);
       tcph_ack->flags = grub_cpu_to_be16_compile_time ((5 << 12) | TCP_ACK);
-      tcph_ack->window = !sock->i_stall ? grub_cpu_to_be16 (sock->my_window)
-	: 0;
+      tcph_ack->window = tcp_window_field (sock);
     }
   tcph_ack->urgent = 0;
   tcph_ack->src = grub_cpu_to_be16 (sock->in_port);
@@ -455,7 +591,8 @@ grub_net_ip_transport_checksum (struct grub_net_buff *nb,
   return grub_cpu_to_be16 (~c);
 }
 
-/* FIXME: overflow. */
+/* Queued segments are all within one window, so comparing modulo 2^32
+   orders them.  */
 static int
 cmp (const void *a__, const void *b__)
 {
@@ -464,9 +601,9 @@ cmp (const void *a__, const void *b__)
   struct tcphdr *a = (struct tcphdr *) a_->data;
   struct tcphdr *b = (struct tcphdr *) b_->data;
   /* We want the first elements to be on top.  */
-  if (grub_be_to_cpu32 (a->seqnr) < grub_be_to_cpu32 (b->seqnr))
+  if (TCP_SEQ_LT (grub_be_to_cpu32 (a->seqnr), grub_be_to_cpu32 (b->seqnr)))
     return +1;
-  if (grub_be_to_cpu32 (a->seqnr) > grub_be_to_cpu32 (b->seqnr))
+  if (TCP_SEQ_GT (grub_be_to_cpu32 (a->seqnr), grub_be_to_cpu32 (b->seqnr)))
     return -1;
   return 0;
 }
@@ -503,7 +640,7 @@ grub_net_tcp_accept (grub_net_tcp_socket_t sock,
   sock->error_hook = error_hook;
   sock->fin_hook = fin_hook;
   sock->hook_data = hook_data;
-  nb_ack = grub_netbuff_alloc (sizeof (*tcph)
+  nb_ack = grub_netbuff_alloc (sizeof (*tcph) + TCP_SYN_OPTIONS_SIZE
 			       + GRUB_NET_OUR_MAX_IP_HEADER_SIZE
 			       + GRUB_NET_MAX_LINK_HEADER_SIZE);
   if (!nb_ack)
@@ -516,7 +653,7 @@ grub_net_tcp_accept (grub_net_tcp_socket_t sock,
       return err;
     }
 
-  err = grub_netbuff_put (nb_ack, sizeof (*tcph));
+  err = grub_netbuff_put (nb_ack, sizeof (*tcph) + TCP_SYN_OPTIONS_SIZE);
   if (err)
     {
       grub_netbuff_free (nb_ack);
@@ -524,9 +661,13 @@ grub_net_tcp_accept (grub_net_tcp_socket_t sock,
     }
   tcph = (void *) nb_ack->data;
   tcph->ack = grub_cpu_to_be32 (sock->their_cur_seq);
-  tcph->flags = grub_cpu_to_be16_compile_time ((5 << 12) | TCP_SYN | TCP_ACK);
-  tcph->window = grub_cpu_to_be16 (sock->my_window);
+  tcph->flags = grub_cpu_to_be16_compile_time ((7 << 12) | TCP_SYN | TCP_ACK);
+  /* Never scaled in a SYN.  */
+  tcph->window = grub_cpu_to_be16 (sock->my_window > 0xffff ? 0xffff
+				   : sock->my_window);
   tcph->urgent = 0;
+  tcp_fill_syn_options (sock, (grub_uint8_t *) (tcph + 1),
+			sock->my_window_scale != 0);
   sock->established = 1;
   tcp_socket_register (sock);
   err = tcp_send (nb_ack, sock);
@@ -593,7 +734,7 @@ grub_net_tcp_open (char *server,
   socket->fin_hook = fin_hook;
   socket->hook_data = hook_data;
 
-  nb = grub_netbuff_alloc (sizeof (*tcph) + 128);
+  nb = grub_netbuff_alloc (sizeof (*tcph) + TCP_SYN_OPTIONS_SIZE + 128);
   if (!nb)
     return NULL;
   err = grub_netbuff_reserve (nb, 128);
@@ -603,7 +744,7 @@ grub_net_tcp_open (char *server,
       return NULL;
     }
 
-  err = grub_netbuff_put (nb, sizeof (*tcph));
+  err = grub_netbuff_put (nb, sizeof (*tcph) + TCP_SYN_OPTIONS_SIZE);
   if (err)
     {
       grub_netbuff_free (nb);
@@ -619,12 +760,15 @@ grub_net_tcp_open (char *server,
   tcph = (void *) nb->data;
   socket->my_start_seq = grub_get_time_ms ();
   socket->my_cur_seq = socket->my_start_seq + 1;
-  socket->my_window = 8192;
+  tcp_init_window (socket);
   tcph->seqnr = grub_cpu_to_be32 (socket->my_start_seq);
   tcph->ack = grub_cpu_to_be32_compile_time (0);
-  tcph->flags = grub_cpu_to_be16_compile_time ((5 << 12) | TCP_SYN);
-  tcph->window = grub_cpu_to_be16 (socket->my_window);
+  tcph->flags = grub_cpu_to_be16_compile_time ((7 << 12) | TCP_SYN);
+  /* Never scaled in a SYN.  */
+  tcph->window = grub_cpu_to_be16 (socket->my_window > 0xffff ? 0xffff
+				   : socket->my_window);
   tcph->urgent = 0;
+  tcp_fill_syn_options (socket, (grub_uint8_t *) (tcph + 1), 1);
   tcph->src = grub_cpu_to_be16 (socket->in_port);
   tcph->dst = grub_cpu_to_be16 (socket->out_port);
   tcph->checksum = 0;
@@ -709,8 +853,7 @@ grub_net_send_tcp_packet (const grub_net_tcp_socket_t socket,
       tcph = (struct tcphdr *) nb2->data;
       tcph->ack = grub_cpu_to_be32 (socket->their_cur_seq);
       tcph->flags = grub_cpu_to_be16_compile_time ((5 << 12) | TCP_ACK);
-      tcph->window = !socket->i_stall ? grub_cpu_to_be16 (socket->my_window)
-	: 0;
+      tcph->window = tcp_window_field (socket);
       tcph->urgent = 0;
       err = grub_netbuff_put (nb2, fraglen);
       if (err)
@@ -733,7 +876,7 @@ grub_net_send_tcp_packet (const grub_net_tcp_socket_t socket,
   tcph->ack = grub_cpu_to_be32 (socket->their_cur_seq);
   tcph->flags = (grub_cpu_to_be16_compile_time ((5 << 12) | TCP_ACK)
 		 | (push ? grub_cpu_to_be16_compile_time (TCP_PUSH) : 0));
-  tcph->window = !socket->i_stall ? grub_cpu_to_be16 (socket->my_window) : 0;
+  tcph->window = tcp_window_field (socket);
   tcph->urgent = 0;
   return tcp_send (nb, socket);
 }
@@ -804,6 +947,8 @@ grub_net_recv_tcp_packet (struct grub_net_buff *nb,
       {
 	sock->their_start_seq = grub_be_to_cpu32 (tcph->seqnr);
 	sock->their_cur_seq = sock->their_start_seq + 1;
+	if (!tcp_syn_has_window_scale (tcph))
+	  tcp_disable_window_scale (sock);
 	sock->established = 1;
       }
 
@@ -835,7 +980,7 @@ grub_net_recv_tcp_packet (struct grub_net_buff *nb,
 	    if (grub_be_to_cpu16 (unack_tcph->flags) & TCP_FIN)
 	      seqnr++;
 
-	    if (seqnr > acked)
+	    if (TCP_SEQ_GT (seqnr, acked))
 	      break;
 	    grub_netbuff_free (unack->nb);
 	    grub_free (unack);
@@ -845,7 +990,7 @@ grub_net_recv_tcp_packet (struct grub_net_buff *nb,
 	  sock->unack_last = NULL;
       }
 
-    if (grub_be_to_cpu32 (tcph->seqnr) < sock->their_cur_seq)
+    if (TCP_SEQ_LT (grub_be_to_cpu32 (tcph->seqnr), sock->their_cur_seq))
       {
 	ack (sock);
 	grub_netbuff_free (nb);
@@ -869,6 +1014,7 @@ grub_net_recv_tcp_packet (struct grub_net_buff *nb,
       struct grub_net_buff **nb_top_p, *nb_top;
       int do_ack = 0;
       int just_closed = 0;
+      int segments = 0;
       while (1)
 	{
 	  nb_top_p = grub_priority_queue_top (sock->pq);
@@ -876,13 +1022,18 @@ grub_net_recv_tcp_packet (struct grub_net_buff *nb,
 	    return GRUB_ERR_NONE;
 	  nb_top = *nb_top_p;
 	  tcph = (struct tcphdr *) nb_top->data;
-	  if (grub_be_to_cpu32 (tcph->seqnr) >= sock->their_cur_seq)
+	  if (!TCP_SEQ_LT (grub_be_to_cpu32 (tcph->seqnr), sock->their_cur_seq))
 	    break;
 	  grub_netbuff_free (nb_top);
 	  grub_priority_queue_pop (sock->pq);
 	}
       if (grub_be_to_cpu32 (tcph->seqnr) != sock->their_cur_seq)
-	return GRUB_ERR_NONE;
+	{
+	  /* Out of order: a duplicate ACK right away lets the peer
+	     retransmit the missing segment without waiting for a timeout.  */
+	  ack (sock);
+	  return GRUB_ERR_NONE;
+	}
       while (1)
 	{
 	  nb_top_p = grub_priority_queue_top (sock->pq);
@@ -894,6 +1045,7 @@ grub_net_recv_tcp_packet (struct grub_net_buff *nb,
 	  if (grub_be_to_cpu32 (tcph->seqnr) != sock->their_cur_seq)
 	    break;
 	  grub_priority_queue_pop (sock->pq);
+	  segments++;
 
 	  err = grub_netbuff_pull (nb_top, (grub_be_to_cpu16 (tcph->flags)
 					    >> 12) * sizeof (grub_uint32_t));
@@ -915,11 +1067,17 @@ grub_net_recv_tcp_packet (struct grub_net_buff *nb,
 	  if ((nb_top->tail - nb_top->data) > 0)
 	    {
 	      grub_net_put_packet (&sock->packs, nb_top);
-	      do_ack = 1;
+	      sock->ack_pending++;
 	    }
 	  else
 	    grub_netbuff_free (nb_top);
 	}
+      /* Acknowledge a FIN, a filled gap, data beyond a remaining gap and
+	 every few segments right away. Otherwise the ACK waits until the
+	 card has no more frames, see grub_net_tcp_flush_acks.  */
+      if (segments > 1 || sock->ack_pending >= TCP_DELAYED_ACK_SEGMENTS
+	  || grub_priority_queue_top (sock->pq))
+	do_ack = 1;
       if (do_ack)
 	ack (sock);
       while (sock->packs.first)
@@ -958,7 +1116,9 @@ grub_net_recv_tcp_packet (struct grub_net_buff *nb,
 	sock->their_start_seq = grub_be_to_cpu32 (tcph->seqnr);
 	sock->their_cur_seq = sock->their_start_seq + 1;
 	sock->my_cur_seq = sock->my_start_seq = grub_get_time_ms ();
-	sock->my_window = 8192;
+	tcp_init_window (sock);
+	if (!tcp_syn_has_window_scale (tcph))
+	  tcp_disable_window_scale (sock);
 
 	sock->pq = grub_priority_queue_new (sizeof (struct grub_net_buff *),
 					    cmp);
@@ -979,6 +1139,16 @@ grub_net_recv_tcp_packet (struct grub_net_buff *nb,
   return GRUB_ERR_NONE;
 }
 
+void
+grub_net_tcp_flush_acks (void)
+{
+  grub_net_tcp_socket_t sock;
+
+  FOR_TCP_SOCKETS (sock)
+    if (sock->ack_pending)
+      ack (sock);
+}
+
 void
 grub_net_tcp_stall (grub_net_tcp_socket_t sock)
 {
@@ -27,6 +27,8 @@
 #include <grub/file.h>
 #include <grub/priority_queue.h>
 #include <grub/i18n.h>
+#include <grub/env.h>
+#include <grub/time.h>
 
 GRUB_MOD_LICENSE ("GPLv3+");
 
@@ -42,6 +44,20 @@ enum
 enum
   {
     TFTP_DEFAULTSIZE_PACKET = 512,
+    /* Used when the MTU can't be found.  */
+    TFTP_FALLBACK_BLKSIZE = 1024,
+    /* The limits of RFC 2348.  */
+    TFTP_MIN_BLKSIZE = 8,
+    TFTP_MAX_BLKSIZE = 65464,
+    TFTP_DEFAULT_WINDOWSIZE = 16,
+    /* The limits of RFC 7440.  */
+    TFTP_MIN_WINDOWSIZE = 1,
+    TFTP_MAX_WINDOWSIZE = 65535,
+    /* Stop acknowledging while this many packets wait to be read.  */
+    TFTP_MAX_QUEUED = 50,
+    /* With a window, ask for the rest again after this long without new
+       blocks, as nothing else would tell the server that some were lost.  */
+    TFTP_WINDOW_TIMEOUT = GRUB_NET_INTERVAL
   };
 
 enum
@@ -102,7 +118,11 @@ typedef struct tftp_data
   grub_uint64_t file_size;
   grub_uint64_t block;
   grub_uint32_t block_size;
+  grub_uint32_t window_size;
   grub_uint64_t ack_sent;
+  /* The block after which a gap was reported.  */
+  grub_uint64_t gap_acked;
+  grub_uint64_t last_block_time;
   int have_oack;
   struct grub_error_saved save_err;
   grub_net_udp_socket_t sock;
@@ -181,7 +201,8 @@ tftp_receive (grub_net_udp_socket_t sock __attribute__ ((unused)),
     {
     case TFTP_OACK:
       data->block_size = TFTP_DEFAULTSIZE_PACKET;
-      data->have_oack = 1; 
+      data->window_size = 1;
+      data->have_oack = 1;
       for (ptr = nb->data + sizeof (tftph->opcode); ptr < nb->tail;)
 	{
 	  if (grub_memcmp (ptr, "tsize\0", sizeof ("tsize\0") - 1) == 0)
@@ -190,11 +211,20 @@ tftp_receive (grub_net_udp_socket_t sock __attribute__ ((unused)),
 	  if (grub_memcmp (ptr, "blksize\0", sizeof ("blksize\0") - 1) == 0)
 	    data->block_size = grub_strtoul ((char *) ptr + sizeof ("blksize\0")
 					     - 1, 0, 0);
+	  if (grub_memcmp (ptr, "windowsize\0",
+			   sizeof ("windowsize\0") - 1) == 0)
+	    data->window_size = grub_strtoul ((char *) ptr
+					      + sizeof ("windowsize\0") - 1,
+					      0, 0);
 	  while (ptr < nb->tail && *ptr)
 	    ptr++;
 	  ptr++;
 	}
+      if (data->window_size < TFTP_MIN_WINDOWSIZE)
+	data->window_size = TFTP_MIN_WINDOWSIZE;
       data->block = 0;
+      data->gap_acked = (grub_uint64_t) -1;
+      data->last_block_time = grub_get_time_ms ();
       grub_netbuff_free (nb);
       err = ack (data, 0);
       grub_error_save (&data->save_err);
@@ -211,69 +241,96 @@ tftp_receive (grub_net_udp_socket_t sock __attribute__ ((unused)),
       if (err)
 	return err;
 
-      {
-	struct grub_net_buff **nb_top_p, *nb_top;
-	while (1)
-	  {
-	    nb_top_p = grub_priority_queue_top (data->pq);
-	    if (!nb_top_p)
-	      return GRUB_ERR_NONE;
-	    nb_top = *nb_top_p;
-	    tftph = (struct tftphdr *) nb_top->data;
-	    if (cmp_block (grub_be_to_cpu16 (tftph->u.data.block), data->block + 1) >= 0)
-	      break;
-	    ack (data, grub_be_to_cpu16 (tftph->u.data.block));
-	    grub_netbuff_free (nb_top);
-	    grub_priority_queue_pop (data->pq);
-	  }
-	while (cmp_block (grub_be_to_cpu16 (tftph->u.data.block), data->block + 1) == 0)
-	  {
-	    unsigned size;
-
-	    grub_priority_queue_pop (data->pq);
-
-	    if (file->device->net->packs.count < 50)
-	      err = ack (data, data->block + 1);
-	    else
-	      {
-		file->device->net->stall = 1;
-		err = 0;
-	      }
-	    if (err)
-	      return err;
-
-	    err = grub_netbuff_pull (nb_top, sizeof (tftph->opcode) +
-				     sizeof (tftph->u.data.block));
-	    if (err)
-	      return err;
-	    size = nb_top->tail - nb_top->data;
-
-	    data->block++;
-	    if (size < data->block_size)
-	      {
-		if (data->ack_sent < data->block)
+      /* Take the blocks in order for as long as there are any. Blocks
+	 arrive out of order when a window is resent after a loss.  */
+      while (1)
+	{
+	  struct grub_net_buff **nb_top_p, *nb_top;
+	  unsigned size;
+	  int c;
+
+	  nb_top_p = grub_priority_queue_top (data->pq);
+	  if (!nb_top_p)
+	    break;
+	  nb_top = *nb_top_p;
+	  tftph = (struct tftphdr *) nb_top->data;
+	  c = cmp_block (grub_be_to_cpu16 (tftph->u.data.block),
+			 data->block + 1);
+	  if (c > 0)
+	    {
+	      /* A block is missing. Have the server go back to it rather
+		 than wait for it to time out, but only once, as the rest
+		 of its window will keep coming.  */
+	      if (data->window_size > 1 && data->gap_acked != data->block)
+		{
+		  data->gap_acked = data->block;
 		  ack (data, data->block);
-		file->device->net->eof = 1;
-		file->device->net->stall = 1;
-		grub_net_udp_close (data->sock);
-		data->sock = NULL;
-	      }
-	    /* Prevent garbage in broken cards. Is it still necessary
-	       given that IP implementation has been fixed?
-	     */
-	    if (size > data->block_size)
-	      {
-		err = grub_netbuff_unput (nb_top, size - data->block_size);
-		if (err)
-		  return err;
-	      }
-	    /* If there is data, puts packet in socket list. */
-	    if ((nb_top->tail - nb_top->data) > 0)
-	      grub_net_put_packet (&file->device->net->packs, nb_top);
-	    else
+		}
+	      break;
+	    }
+
+	  grub_priority_queue_pop (data->pq);
+
+	  if (c < 0)
+	    {
+	      /* A duplicate. Without a window it means our ACK was lost.
+		 With one, the lost ACKs are resent on a timeout instead,
+		 as acknowledging every duplicate of a resent window would
+		 have the server restart it over and over.  */
+	      if (data->window_size == 1)
+		ack (data, data->block);
 	      grub_netbuff_free (nb_top);
-	  }
-      }
+	      continue;
+	    }
+
+	  err = grub_netbuff_pull (nb_top, sizeof (tftph->opcode) +
+				   sizeof (tftph->u.data.block));
+	  if (err)
+	    return err;
+	  size = nb_top->tail - nb_top->data;
+
+	  data->block++;
+	  data->last_block_time = grub_get_time_ms ();
+	  if (size < data->block_size)
+	    {
+	      if (data->ack_sent < data->block)
+		ack (data, data->block);
+	      file->device->net->eof = 1;
+	      file->device->net->stall = 1;
+	      grub_net_udp_close (data->sock);
+	      data->sock = NULL;
+	    }
+	  else if (data->block - data->ack_sent >= data->window_size)
+	    {
+	      /* The end of a window.  */
+	      if (file->device->net->packs.count < TFTP_MAX_QUEUED)
+		{
+		  err = ack (data, data->block);
+		  if (err)
+		    return err;
+		}
+	      else
+		file->device->net->stall = 1;
+	    }
+
+	  /* Prevent garbage in broken cards. Is it still necessary
+	     given that IP implementation has been fixed?
+	   */
+	  if (size > data->block_size)
+	    {
+	      err = grub_netbuff_unput (nb_top, size - data->block_size);
+	      if (err)
+		return err;
+	    }
+	  /* If there is data, puts packet in socket list. */
+	  if ((nb_top->tail - nb_top->data) > 0)
+	    grub_net_put_packet (&file->device->net->packs, nb_top);
+	  else
+	    grub_netbuff_free (nb_top);
+
+	  if (file->device->net->eof)
+	    break;
+	}
       return GRUB_ERR_NONE;
     case TFTP_ERROR:
       data->have_oack = 1;
@@ -300,6 +357,60 @@ destroy_pq (tftp_data_t data)
   grub_priority_queue_destroy (data->pq);
 }
 
+/* The value of the environment variable NAME within MIN and MAX, or DEF
+   if it isn't set or isn't a number.  */
+static grub_uint32_t
+tftp_env_option (const char *name, grub_uint32_t def,
+		 grub_uint32_t min, grub_uint32_t max)
+{
+  const char *val = grub_env_get (name);
+  const char *end;
+  unsigned long n;
+
+  if (!val)
+    return def;
+
+  n = grub_strtoul (val, (char **) &end, 0);
+  if (grub_errno || *end || end == val)
+    {
+      grub_dprintf ("tftp", "ignoring invalid %s=%s\n", name, val);
+      grub_errno = GRUB_ERR_NONE;
+      return def;
+    }
+  if (n < min)
+    return min;
+  if (n > max)
+    return max;
+  return n;
+}
+
+/* The largest block which fits in a single frame to ADDR. Larger ones
+   work as well but need the IP layer to reassemble fragments.  */
+static grub_uint32_t
+tftp_mtu_blksize (grub_net_network_level_address_t addr)
+{
+  grub_net_network_level_address_t gateway;
+  struct grub_net_network_level_interface *inf;
+  grub_size_t overhead;
+
+  overhead = sizeof (struct udphdr) + 2 * sizeof (grub_uint16_t);
+  if (addr.type == GRUB_NET_NETWORK_LEVEL_PROTOCOL_IPV6)
+    overhead += 40;
+  else
+    overhead += 20;
+
+  if (grub_net_route_address (addr, &gateway, &inf))
+    {
+      grub_errno = GRUB_ERR_NONE;
+      return TFTP_FALLBACK_BLKSIZE;
+    }
+  if (inf->card->mtu < overhead + TFTP_DEFAULTSIZE_PACKET)
+    return TFTP_DEFAULTSIZE_PACKET;
+  if (inf->card->mtu - overhead > TFTP_MAX_BLKSIZE)
+    return TFTP_MAX_BLKSIZE;
+  return inf->card->mtu - overhead;
+}
+
 static grub_err_t
 tftp_open (struct grub_file *file, const char *filename)
 {
@@ -314,10 +425,22 @@ tftp_open (struct grub_file *file, const char *filename)
   grub_err_t err;
   grub_uint8_t *nbd;
   grub_net_network_level_address_t addr;
+  grub_uint32_t blksize, windowsize;
+  char optval[sizeof ("4294967295")];
+
+  err = grub_net_resolve_address (file->device->net->server, &addr);
+  if (err)
+    return err;
+
+  blksize = tftp_env_option ("tftp_blksize", tftp_mtu_blksize (addr),
+			     TFTP_MIN_BLKSIZE, TFTP_MAX_BLKSIZE);
+  windowsize = tftp_env_option ("tftp_windowsize", TFTP_DEFAULT_WINDOWSIZE,
+				TFTP_MIN_WINDOWSIZE, TFTP_MAX_WINDOWSIZE);
 
   data = grub_zalloc (sizeof (*data));
   if (!data)
     return grub_errno;
+  data->window_size = 1;
 
   nb.head = open_data;
   nb.end = open_data + sizeof (open_data);
@@ -346,9 +469,22 @@ tftp_open (struct grub_file *file, const char *filename)
   rrqlen += grub_strlen ("blksize") + 1;
   rrq += grub_strlen ("blksize") + 1;
 
-  grub_strcpy (rrq, "1024");
-  rrqlen += grub_strlen ("1024") + 1;
-  rrq += grub_strlen ("1024") + 1;
+  grub_snprintf (optval, sizeof (optval), "%u", blksize);
+  grub_strcpy (rrq, optval);
+  rrqlen += grub_strlen (optval) + 1;
+  rrq += grub_strlen (optval) + 1;
+
+  if (windowsize > 1)
+    {
+      grub_strcpy (rrq, "windowsize");
+      rrqlen += grub_strlen ("windowsize") + 1;
+      rrq += grub_strlen ("windowsize") + 1;
+
+      grub_snprintf (optval, sizeof (optval), "%u", windowsize);
+      grub_strcpy (rrq, optval);
+      rrqlen += grub_strlen (optval) + 1;
+      rrq += grub_strlen (optval) + 1;
+    }
 
   grub_strcpy (rrq, "tsize");
   rrqlen += grub_strlen ("tsize") + 1;
@@ -370,13 +506,6 @@ tftp_open (struct grub_file *file, const char *filename)
   if (!data->pq)
     return grub_errno;
 
-  err = grub_net_resolve_address (file->device->net->server, &addr);
-  if (err)
-    {
-      destroy_pq (data);
-      return err;
-    }
-
   data->sock = grub_net_udp_open (addr,
 				  TFTP_SERVER_PORT, tftp_receive,
 				  file);
@@ -462,14 +591,23 @@ static grub_err_t
 tftp_packets_pulled (struct grub_file *file)
 {
   tftp_data_t data = file->data;
-  if (file->device->net->packs.count >= 50)
+  if (file->device->net->packs.count >= TFTP_MAX_QUEUED)
     return 0;
 
   if (!file->device->net->eof)
     file->device->net->stall = 0;
-  if (data->ack_sent >= data->block)
-    return 0;
-  return ack (data, data->block);
+  /* The end of a window was held back while the queue was full.  */
+  if (data->block - data->ack_sent >= data->window_size)
+    return ack (data, data->block);
+
+  if (data->window_size > 1 && data->sock
+      && (grub_get_time_ms () - data->last_block_time
+	  >= TFTP_WINDOW_TIMEOUT))
+    {
+      data->last_block_time = grub_get_time_ms ();
+      return ack (data, data->block);
+    }
+  return 0;
 }
 
 static struct grub_net_app_protocol grub_tftp_protocol = 
@@ -0,0 +1,152 @@
+/*
+ *  GRUB  --  GRand Unified Bootloader
+ *  Copyright (C) 2024  Free Software Foundation, Inc.
+ *
+ *  GRUB is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  GRUB is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with GRUB.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <grub/test.h>
+#include <grub/dl.h>
+#include <grub/misc.h>
+#include <grub/crypto.h>
+
+GRUB_MOD_LICENSE ("GPLv3+");
+
+extern gcry_cipher_spec_t _gcry_cipher_spec_aes192;
+extern gcry_cipher_spec_t _gcry_cipher_spec_aes256;
+
+#define RANDOM_KEYS	16
+#define RANDOM_BLOCKS	64
+
+static const grub_uint8_t plaintext[16] =
+  "\x00\x11\x22\x33\x44\x55\x66\x77\x88\x99\xaa\xbb\xcc\xdd\xee\xff";
+
+static struct
+{
+  const char *name;
+  gcry_cipher_spec_t *portable;
+  unsigned keylen;
+  const char *ciphertext;
+} vectors[] = {
+  /* FIPS-197 C.1 to C.3, the key is 00 01 02 ...  */
+  {
+    "AES", &_gcry_cipher_spec_aes, 16,
+    "\x69\xc4\xe0\xd8\x6a\x7b\x04\x30\xd8\xcd\xb7\x80\x70\xb4\xc5\x5a"
+  },
+  {
+    "AES192", &_gcry_cipher_spec_aes192, 24,
+    "\xdd\xa9\x7c\xa4\x86\x4c\xdf\xe0\x6e\xaf\x70\xa0\xec\x0d\x71\x91"
+  },
+  {
+    "AES256", &_gcry_cipher_spec_aes256, 32,
+    "\x8e\xa2\xb7\xca\x51\x67\x45\xbf\xea\xfc\x49\x90\x4b\x49\x60\x89"
+  }
+};
+
+static void
+known_answer (const gcry_cipher_spec_t *spec, unsigned keylen,
+	      const char *expected)
+{
+  grub_crypto_cipher_handle_t h;
+  grub_uint8_t key[32], buf[16];
+  unsigned i;
+
+  for (i = 0; i < keylen; i++)
+    key[i] = i;
+
+  h = grub_crypto_cipher_open (spec);
+  grub_test_assert (h != NULL, "cannot open %s", spec->name);
+  if (!h)
+    return;
+  grub_test_assert (grub_crypto_cipher_set_key (h, key, keylen) == 0,
+		    "%s: setkey failed", spec->name);
+  grub_crypto_ecb_encrypt (h, buf, plaintext, sizeof (buf));
+  grub_test_assert (grub_memcmp (buf, expected, sizeof (buf)) == 0,
+		    "%s: encryption mismatch", spec->name);
+  grub_crypto_ecb_decrypt (h, buf, buf, sizeof (buf));
+  grub_test_assert (grub_memcmp (buf, plaintext, sizeof (buf)) == 0,
+		    "%s: decryption mismatch", spec->name);
+  grub_crypto_cipher_close (h);
+}
+
+/* Compare the implementation in use with the portable one.  */
+static void
+cross_check (const gcry_cipher_spec_t *active,
+	     const gcry_cipher_spec_t *portable, unsigned keylen)
+{
+  grub_crypto_cipher_handle_t a, p;
+  grub_uint8_t key[32];
+  grub_uint8_t in[RANDOM_BLOCKS * 16], out_a[sizeof (in)], out_p[sizeof (in)];
+  grub_uint32_t seed = 1;
+  unsigned i;
+
+  a = grub_crypto_cipher_open (active);
+  p = grub_crypto_cipher_open (portable);
+  grub_test_assert (a && p, "cannot open %s", active->name);
+  if (!a || !p)
+    goto out;
+
+  for (i = 0; i < RANDOM_KEYS; i++)
+    {
+      grub_test_fill_random (&seed, key, keylen);
+      grub_test_fill_random (&seed, in, sizeof (in));
+      grub_crypto_cipher_set_key (a, key, keylen);
+      grub_crypto_cipher_set_key (p, key, keylen);
+
+      grub_crypto_ecb_encrypt (a, out_a, in, sizeof (in));
+      grub_crypto_ecb_encrypt (p, out_p, in, sizeof (in));
+      grub_test_assert (grub_memcmp (out_a, out_p, sizeof (in)) == 0,
+			"%s: encryption differs from the portable code",
+			active->name);
+
+      grub_crypto_ecb_decrypt (a, out_a, in, sizeof (in));
+      grub_crypto_ecb_decrypt (p, out_p, in, sizeof (in));
+      grub_test_assert (grub_memcmp (out_a, out_p, sizeof (in)) == 0,
+			"%s: decryption differs from the portable code",
+			active->name);
+    }
+
+ out:
+  grub_crypto_cipher_close (a);
+  grub_crypto_cipher_close (p);
+}
+
+static void
+aes_test (void)
+{
+  grub_size_t i;
+
+  /* Where there's no aes_hw or no AES instructions the portable code is
+     checked against itself.  */
+  grub_dl_load ("aes_hw");
+  grub_errno = GRUB_ERR_NONE;
+
+  for (i = 0; i < ARRAY_SIZE (vectors); i++)
+    {
+      const gcry_cipher_spec_t *active;
+
+      active = grub_crypto_lookup_cipher_by_name (vectors[i].name);
+      grub_test_assert (active != NULL, "%s not found", vectors[i].name);
+      if (!active)
+	continue;
+
+      known_answer (vectors[i].portable, vectors[i].keylen,
+		    vectors[i].ciphertext);
+      known_answer (active, vectors[i].keylen, vectors[i].ciphertext);
+      cross_check (active, vectors[i].portable, vectors[i].keylen);
+    }
+}
+
+/* Register example_test method as a functional test.  */
+GRUB_FUNCTIONAL_TEST (aes_test, aes_test);
@@ -0,0 +1,133 @@
+/*
+ *  GRUB  --  GRand Unified Bootloader
+ *  Copyright (C) 2024  Free Software Foundation, Inc.
+ *
+ *  GRUB is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  GRUB is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with GRUB.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <grub/test.h>
+#include <grub/dl.h>
+#include <grub/misc.h>
+#include <grub/mm.h>
+#include <grub/crypto.h>
+#include <grub/lib/crc.h>
+
+GRUB_MOD_LICENSE ("GPLv3+");
+
+#define CRC32C_POLY	0x82f63b78
+#define CRC64_POLY	0xc96c5795d7870f42ULL
+
+#define BUF_SIZE	65536
+#define RANDOM_RUNS	500
+
+static grub_uint32_t crc32c_ref_table[256];
+static grub_uint64_t crc64_ref_table[256];
+
+/* The plain byte at a time CRCs, as the reference.  */
+static void
+init_crc_tables (void)
+{
+  unsigned i, j;
+
+  for (i = 0; i < 256; i++)
+    {
+      grub_uint32_t c32 = i;
+      grub_uint64_t c64 = i;
+
+      for (j = 0; j < 8; j++)
+	{
+	  c32 = (c32 >> 1) ^ ((c32 & 1) ? CRC32C_POLY : 0);
+	  c64 = (c64 >> 1) ^ ((c64 & 1) ? CRC64_POLY : 0);
+	}
+      crc32c_ref_table[i] = c32;
+      crc64_ref_table[i] = c64;
+    }
+}
+
+static grub_uint32_t
+crc32c_ref (grub_uint32_t crc, const grub_uint8_t *data, grub_size_t size)
+{
+  crc = ~crc;
+  while (size--)
+    crc = (crc >> 8) ^ crc32c_ref_table[(crc ^ *data++) & 0xff];
+  return ~crc;
+}
+
+static grub_uint64_t
+crc64_ref (grub_uint64_t crc, const grub_uint8_t *data, grub_size_t size)
+{
+  crc = ~crc;
+  while (size--)
+    crc = (crc >> 8) ^ crc64_ref_table[(crc ^ *data++) & 0xff];
+  return ~crc;
+}
+
+static grub_uint64_t
+crc64 (grub_uint64_t crc, const grub_uint8_t *data, grub_size_t size)
+{
+  const gcry_md_spec_t *md = GRUB_MD_CRC64;
+  grub_uint64_t ctx;
+
+  md->init (&ctx);
+  ctx = grub_cpu_to_le64 (crc);
+  md->write (&ctx, data, size);
+  md->final (&ctx);
+  return grub_le_to_cpu64 (ctx);
+}
+
+static void
+crc_test (void)
+{
+  grub_uint8_t *buf;
+  grub_uint32_t seed = 1;
+  unsigned i;
+
+  init_crc_tables ();
+
+  /* The check values of CRC-32C and CRC-64/XZ.  */
+  grub_test_assert (grub_getcrc32c (0, "123456789", 9) == 0xe3069283,
+		    "CRC32C check value mismatch");
+  grub_test_assert (crc64 (0, (const grub_uint8_t *) "123456789", 9)
+		    == 0x995dc9bbdf1939faULL, "CRC64 check value mismatch");
+
+  buf = grub_malloc (BUF_SIZE + 8);
+  grub_test_assert (buf != NULL, "out of memory");
+  if (!buf)
+    return;
+  grub_test_fill_random (&seed, buf, BUF_SIZE + 8);
+
+  /* All alignments and lengths around the 8 byte steps, continuing from
+     arbitrary previous values.  */
+  for (i = 0; i < RANDOM_RUNS; i++)
+    {
+      unsigned off = grub_test_random (&seed) % 8;
+      unsigned len = (i < 64) ? i : grub_test_random (&seed) % 4096;
+      grub_uint32_t c32 = grub_test_random (&seed);
+      grub_uint64_t c64 = grub_test_random (&seed);
+
+      c64 = (c64 << 32) ^ grub_test_random (&seed);
+
+      grub_test_assert (grub_getcrc32c (c32, buf + off, len)
+			== crc32c_ref (c32, buf + off, len),
+			"CRC32C mismatch at offset %u length %u", off, len);
+      grub_test_assert (crc64 (c64, buf + off, len)
+			== crc64_ref (c64, buf + off, len),
+			"CRC64 mismatch at offset %u length %u", off, len);
+    }
+
+  grub_free (buf);
+}
+
+/* Register example_test method as a functional test.  */
+GRUB_FUNCTIONAL_TEST (crc_test, crc_test);
@@ -0,0 +1,212 @@
+/*
+ *  GRUB  --  GRand Unified Bootloader
+ *  Copyright (C) 2024  Free Software Foundation, Inc.
+ *
+ *  GRUB is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  GRUB is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with GRUB.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <grub/test.h>
+#include <grub/dl.h>
+#include <grub/misc.h>
+#include <grub/mm.h>
+#include <grub/fdt.h>
+
+GRUB_MOD_LICENSE ("GPLv3+");
+
+#define TREE_SIZE	4096
+#define FDT_END		0x00000009
+
+static const char old_bootargs[] = "console=ttyS0";
+static const char new_bootargs[] = "console=ttyS0 androidboot.mode=charger";
+static const char compatible[] = "shared-dma-pool";
+
+/* A tree to start from, built with the plain fdt functions. Every edit
+   can move the nodes, so they are looked up again each time.  */
+static int
+build_tree (void *fdt)
+{
+  int node;
+
+  if (grub_fdt_create_empty_tree (fdt, TREE_SIZE) != 0
+      || grub_fdt_add_subnode (fdt, 0, "chosen") < 0
+      || grub_fdt_add_subnode (fdt, 0, "memory") < 0
+      || grub_fdt_add_subnode (fdt, 0, "soc") < 0)
+    return -1;
+
+  node = grub_fdt_find_subnode (fdt, 0, "soc");
+  if (node < 0 || grub_fdt_add_subnode (fdt, node, "serial@1000") < 0)
+    return -1;
+  node = grub_fdt_find_subnode (fdt, grub_fdt_find_subnode (fdt, 0, "soc"),
+				"serial@1000");
+  if (node < 0 || grub_fdt_set_prop (fdt, node, "status", "okay", 5) != 0)
+    return -1;
+
+  node = grub_fdt_find_subnode (fdt, 0, "memory");
+  if (node < 0 || grub_fdt_set_prop64 (fdt, node, "reg", 0x80000000) != 0)
+    return -1;
+
+  node = grub_fdt_find_subnode (fdt, 0, "chosen");
+  if (node < 0
+      || grub_fdt_set_prop (fdt, node, "bootargs", old_bootargs,
+			    sizeof (old_bootargs)) != 0)
+    return -1;
+  node = grub_fdt_find_subnode (fdt, 0, "chosen");
+  if (node < 0
+      || grub_fdt_set_prop64 (fdt, node, "linux,initrd-start",
+			      0x84000000) != 0)
+    return -1;
+  return 0;
+}
+
+/* Open a session on FDT and make the edits the checks expect.  */
+static grub_fdt_edit_t
+edit_tree (const void *fdt)
+{
+  grub_fdt_edit_t edit;
+  int chosen, soc, uart, reserved;
+
+  edit = grub_fdt_edit_begin (fdt);
+  grub_test_assert (edit != NULL, "cannot open the editing session");
+  if (!edit)
+    return NULL;
+
+  chosen = grub_fdt_edit_find_subnode (edit, 0, "chosen");
+  soc = grub_fdt_edit_find_subnode (edit, 0, "soc");
+  grub_test_assert (chosen > 0 && soc > 0, "nodes missing from the session");
+  uart = grub_fdt_edit_find_subnode (edit, soc, "serial@1000");
+  grub_test_assert (uart > 0, "subnode missing from the session");
+
+  grub_test_assert (grub_fdt_edit_set_prop (edit, chosen, "bootargs",
+					    new_bootargs,
+					    sizeof (new_bootargs)) == 0,
+		    "cannot change a property");
+  grub_test_assert (grub_fdt_edit_set_prop64 (edit, chosen, "linux,initrd-end",
+					      0x85000000) == 0,
+		    "cannot add a property");
+  grub_test_assert (grub_fdt_edit_del_prop (edit, chosen,
+					    "linux,initrd-start") == 0,
+		    "cannot delete a property");
+  grub_test_assert (grub_fdt_edit_del_prop (edit, chosen,
+					    "linux,initrd-start") < 0,
+		    "deleted a property twice");
+
+  reserved = grub_fdt_edit_add_subnode (edit, 0, "reserved-memory");
+  grub_test_assert (reserved > 0, "cannot add a node");
+  grub_test_assert (grub_fdt_edit_set_prop (edit, reserved, "compatible",
+					    compatible,
+					    sizeof (compatible)) == 0,
+		    "cannot set a property on a new node");
+
+  grub_test_assert (grub_fdt_edit_del_node (edit, soc) == 0,
+		    "cannot delete a node");
+  grub_test_assert (grub_fdt_edit_del_node (edit, 0) < 0,
+		    "deleted the root node");
+  grub_test_assert (grub_fdt_edit_set_prop (edit, uart, "status", "off",
+					    4) < 0
+		    && grub_fdt_edit_add_subnode (edit, soc, "x") < 0,
+		    "edited a deleted node");
+  return edit;
+}
+
+/* Check the committed tree with the plain fdt functions.  */
+static void
+check_tree (void *fdt, grub_uint32_t size)
+{
+  const grub_uint64_t *val64;
+  const char *val;
+  grub_uint32_t len, end;
+  int chosen, memory, reserved;
+
+  grub_test_assert (grub_fdt_check_header (fdt, size) == 0,
+		    "bad header after commit");
+  end = grub_fdt_get_off_dt_struct (fdt) + grub_fdt_get_size_dt_struct (fdt);
+  grub_test_assert (grub_be_to_cpu32 (*(grub_uint32_t *)
+				      ((grub_uint8_t *) fdt + end - 4))
+		    == FDT_END, "structure block size is wrong");
+
+  chosen = grub_fdt_find_subnode (fdt, 0, "chosen");
+  memory = grub_fdt_find_subnode (fdt, 0, "memory");
+  reserved = grub_fdt_find_subnode (fdt, 0, "reserved-memory");
+  grub_test_assert (chosen > 0 && memory > 0 && reserved > 0,
+		    "node missing after commit");
+  grub_test_assert (grub_fdt_find_subnode (fdt, 0, "soc") < 0,
+		    "deleted node still there");
+  if (chosen < 0 || memory < 0 || reserved < 0)
+    return;
+
+  val = grub_fdt_get_prop (fdt, chosen, "bootargs", &len);
+  grub_test_assert (val && len == sizeof (new_bootargs)
+		    && grub_memcmp (val, new_bootargs, len) == 0,
+		    "changed property has the wrong value");
+  val64 = grub_fdt_get_prop (fdt, chosen, "linux,initrd-end", &len);
+  grub_test_assert (val64 && len == 8
+		    && grub_be_to_cpu64 (*val64) == 0x85000000,
+		    "added property has the wrong value");
+  grub_test_assert (!grub_fdt_get_prop (fdt, chosen, "linux,initrd-start",
+					0),
+		    "deleted property still there");
+  val64 = grub_fdt_get_prop (fdt, memory, "reg", &len);
+  grub_test_assert (val64 && len == 8
+		    && grub_be_to_cpu64 (*val64) == 0x80000000,
+		    "untouched property has the wrong value");
+  val = grub_fdt_get_prop (fdt, reserved, "compatible", &len);
+  grub_test_assert (val && len == sizeof (compatible)
+		    && grub_memcmp (val, compatible, len) == 0,
+		    "property of the new node has the wrong value");
+}
+
+static void
+fdt_test (void)
+{
+  grub_uint8_t *src, *out;
+  grub_fdt_edit_t edit;
+  grub_uint32_t size;
+
+  /* The trees need the alignment the fdt functions ask for.  */
+  src = grub_memalign (8, TREE_SIZE);
+  out = grub_memalign (8, TREE_SIZE);
+  grub_test_assert (src && out, "out of memory");
+  if (!src || !out)
+    goto out;
+
+  grub_test_assert (build_tree (src) == 0, "cannot build the source tree");
+  edit = edit_tree (src);
+  if (!edit)
+    goto out;
+
+  /* Into a separate buffer of exactly the size needed.  */
+  size = grub_fdt_edit_get_size (edit);
+  grub_test_assert (grub_fdt_edit_commit (edit, out, size - 8) < 0,
+		    "committed into a buffer that is too small");
+  grub_test_assert (grub_fdt_edit_commit (edit, out, size) == 0,
+		    "cannot commit");
+  check_tree (out, size);
+
+  /* Over the source itself, which must give the same tree.  */
+  grub_test_assert (grub_fdt_edit_commit (edit, out, TREE_SIZE) == 0,
+		    "cannot commit");
+  grub_test_assert (grub_fdt_edit_commit (edit, src, TREE_SIZE) == 0,
+		    "cannot commit over the source");
+  grub_fdt_edit_free (edit);
+  grub_test_assert (grub_memcmp (src, out, TREE_SIZE) == 0,
+		    "commit over the source differs");
+  check_tree (src, TREE_SIZE);
+
+ out:
+  grub_free (src);
+  grub_free (out);
+}
+
+/* Register example_test method as a functional test.  */
+GRUB_FUNCTIONAL_TEST (fdt_test, fdt_test);
@@ -0,0 +1,223 @@
+/*
+ *  GRUB  --  GRand Unified Bootloader
+ *  Copyright (C) 2024  Free Software Foundation, Inc.
+ *
+ *  GRUB is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  GRUB is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with GRUB.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <grub/test.h>
+#include <grub/dl.h>
+#include <grub/misc.h>
+#include <grub/mm.h>
+#include <grub/file.h>
+#include <grub/deflate.h>
+
+GRUB_MOD_LICENSE ("GPLv3+");
+
+/* The streams below were made with zlib.  */
+
+static const char stored_text[] = "GRUB stores this uncompressed.";
+static const char fixed_text[] =
+  "Fixed Huffman codes: abcabcabcabcabcabc, the end.";
+
+/* A stored block.  */
+static const char zlib_stored[] =
+  "\x78\x01\x01\x1e\x00\xe1\xff\x47\x52\x55\x42\x20\x73\x74\x6f\x72"
+  "\x65\x73\x20\x74\x68\x69\x73\x20\x75\x6e\x63\x6f\x6d\x70\x72\x65"
+  "\x73\x73\x65\x64\x2e\xa7\x8f\x0b\x2f";
+
+/* A block with the fixed codes.  */
+static const char zlib_fixed[] =
+  "\x78\x01\x73\xcb\xac\x48\x4d\x51\xf0\x28\x4d\x4b\xcb\x4d\xcc\x53"
+  "\x48\xce\x4f\x49\x2d\xb6\x52\x48\x4c\x4a\x46\x43\x3a\x0a\x25\x19"
+  "\xa9\x0a\xa9\x79\x29\x7a\x00\xb8\x27\x11\x54";
+
+/* A block with its own codes, decoding to dynamic_text ().  */
+static const char zlib_dynamic[] =
+  "\x78\xda\x95\xd1\xc9\x11\xc2\x40\x10\x04\xc1\x3f\x56\x8c\x09\xdb"
+  "\xd3\x9c\xe6\x80\x24\x6e\x58\x10\x88\xcb\x7a\x22\xe4\x41\xbd\xab"
+  "\x7e\x59\x4a\x3c\xf7\x5d\xdc\x87\x43\x73\x8a\x4d\x5f\xdf\xd7\xd8"
+  "\xd6\x4f\x1c\x87\xcb\xed\x11\xf5\xd5\xf5\x63\x3e\xaf\x7f\xdf\x68"
+  "\xeb\x6e\x52\xc4\xf6\x64\xbb\xd9\x3e\x65\xfb\x8c\xed\x73\xb6\x2f"
+  "\xd8\xbe\x64\xfb\x0a\xed\x62\xaa\x62\xaa\x62\xaa\x62\xaa\x62\xaa"
+  "\x62\xaa\x62\xaa\x62\xaa\x62\xaa\x62\xaa\xc9\x54\x93\xa9\x26\x53"
+  "\x4d\xa6\x9a\x4c\x35\x99\x6a\x32\xd5\x64\xaa\xc9\x54\x93\xa9\x9a"
+  "\xa9\x9a\xa9\x9a\xa9\x9a\xa9\x9a\xa9\x9a\xa9\x9a\xa9\x9a\xa9\x9a"
+  "\xa9\x9a\xa9\xfe\x01\x4e\xc1\x95\x87";
+
+/* Raw deflate of 100000 'a's, matches running over the window.  */
+static const char deflate_run[] =
+  "\xed\xc1\x31\x01\x00\x00\x00\xc2\xa0\xac\xeb\x5f\xc2\x1a\x1e\x40"
+  "\x01\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00"
+  "\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00"
+  "\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00"
+  "\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00"
+  "\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00"
+  "\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00"
+  "\x00\xaf\x06";
+
+/* dynamic_text () again, gzip wrapped.  */
+static const char gzip_dynamic[] =
+  "\x1f\x8b\x08\x00\x00\x00\x00\x00\x02\x03\x95\xd1\xc9\x11\xc2\x40"
+  "\x10\x04\xc1\x3f\x56\x8c\x09\xdb\xd3\x9c\xe6\x80\x24\x6e\x58\x10"
+  "\x88\xcb\x7a\x22\xe4\x41\xbd\xab\x7e\x59\x4a\x3c\xf7\x5d\xdc\x87"
+  "\x43\x73\x8a\x4d\x5f\xdf\xd7\xd8\xd6\x4f\x1c\x87\xcb\xed\x11\xf5"
+  "\xd5\xf5\x63\x3e\xaf\x7f\xdf\x68\xeb\x6e\x52\xc4\xf6\x64\xbb\xd9"
+  "\x3e\x65\xfb\x8c\xed\x73\xb6\x2f\xd8\xbe\x64\xfb\x0a\xed\x62\xaa"
+  "\x62\xaa\x62\xaa\x62\xaa\x62\xaa\x62\xaa\x62\xaa\x62\xaa\x62\xaa"
+  "\x62\xaa\xc9\x54\x93\xa9\x26\x53\x4d\xa6\x9a\x4c\x35\x99\x6a\x32"
+  "\xd5\x64\xaa\xc9\x54\x93\xa9\x9a\xa9\x9a\xa9\x9a\xa9\x9a\xa9\x9a"
+  "\xa9\x9a\xa9\x9a\xa9\x9a\xa9\x9a\xa9\x9a\xa9\xfe\x01\x87\x0f\xb4"
+  "\x14\x58\x07\x00\x00";
+
+#define DYNAMIC_LEN	1880
+#define RUN_LEN		100000
+
+/* 40 numbered lines of a pangram.  */
+static char *
+dynamic_text (void)
+{
+  char *text, *p;
+  int i;
+
+  text = grub_malloc (DYNAMIC_LEN + 1);
+  if (!text)
+    return NULL;
+  for (i = 0, p = text; i < 40; i++)
+    p += grub_snprintf (p, text + DYNAMIC_LEN + 1 - p,
+			"%02d the quick brown fox jumps over the lazy dog\n", i);
+  return text;
+}
+
+static void
+check_zlib (const char *name, const char *in, grub_size_t insize,
+	    const char *expected, grub_size_t len)
+{
+  char *out;
+  grub_ssize_t ret;
+
+  out = grub_malloc (len);
+  grub_test_assert (out != NULL, "out of memory");
+  if (!out)
+    return;
+
+  ret = grub_zlib_decompress ((char *) in, insize, 0, out, len);
+  grub_test_assert (ret == (grub_ssize_t) len && grub_memcmp (out, expected,
+							      len) == 0,
+		    "%s: wrong data", name);
+  grub_free (out);
+}
+
+static grub_ssize_t
+mem_read (grub_file_t file, char *buf, grub_size_t len)
+{
+  grub_memcpy (buf, (char *) file->data + file->offset, len);
+  return len;
+}
+
+static struct grub_fs mem_fs =
+  {
+    .name = "inflate_test",
+    .read = mem_read
+  };
+
+/* Read the gzip stream through the gzio file filter, as a whole and from
+   the middle.  */
+static void
+check_gzip (const char *expected)
+{
+  grub_file_t io, file;
+  char *out;
+
+  out = grub_malloc (DYNAMIC_LEN);
+  io = grub_zalloc (sizeof (*io));
+  grub_test_assert (out && io, "out of memory");
+  if (!out || !io)
+    goto out;
+  io->fs = &mem_fs;
+  io->data = (char *) gzip_dynamic;
+  io->size = sizeof (gzip_dynamic) - 1;
+
+  file = grub_file_filters_all[GRUB_FILE_FILTER_GZIO] (io, "test.gz");
+  grub_test_assert (file && file != io, "gzip stream not recognized");
+  if (!file || file == io)
+    goto out;
+  io = NULL;
+
+  grub_test_assert (file->size == DYNAMIC_LEN, "gzip: wrong size");
+  grub_test_assert (grub_file_read (file, out, DYNAMIC_LEN) == DYNAMIC_LEN
+		    && grub_memcmp (out, expected, DYNAMIC_LEN) == 0,
+		    "gzip: wrong data");
+  grub_file_seek (file, 1000);
+  grub_test_assert (grub_file_read (file, out, 100) == 100
+		    && grub_memcmp (out, expected + 1000, 100) == 0,
+		    "gzip: wrong data after seeking");
+  grub_file_close (file);
+
+ out:
+  grub_free (io);
+  grub_free (out);
+}
+
+static void
+inflate_test (void)
+{
+  char *text, *out;
+  grub_ssize_t ret;
+  unsigned i;
+
+  check_zlib ("stored", zlib_stored, sizeof (zlib_stored) - 1,
+	      stored_text, sizeof (stored_text) - 1);
+  check_zlib ("fixed", zlib_fixed, sizeof (zlib_fixed) - 1,
+	      fixed_text, sizeof (fixed_text) - 1);
+
+  text = dynamic_text ();
+  out = grub_malloc (RUN_LEN);
+  grub_test_assert (text && out, "out of memory");
+  if (!text || !out)
+    goto out;
+
+  check_zlib ("dynamic", zlib_dynamic, sizeof (zlib_dynamic) - 1,
+	      text, DYNAMIC_LEN);
+  check_gzip (text);
+
+  /* From offsets in the first, a later and the last window.  */
+  for (i = 0; i < RUN_LEN; i += 33333)
+    {
+      grub_memset (out, 0, RUN_LEN - i);
+      ret = grub_deflate_decompress ((char *) deflate_run,
+				     sizeof (deflate_run) - 1, i, out,
+				     RUN_LEN - i);
+      grub_test_assert (ret == (grub_ssize_t) (RUN_LEN - i),
+			"run from %u: got %" PRIdGRUB_SSIZE " bytes", i, ret);
+      grub_test_assert (ret <= 0 || (out[0] == 'a' && out[ret - 1] == 'a'
+				     && grub_memcmp (out, out + 1, ret - 1) == 0),
+			"run from %u: wrong data", i);
+    }
+
+  /* A truncated stream has to fail, not return made up data.  */
+  ret = grub_zlib_decompress ((char *) zlib_dynamic, 80, 0, out,
+			      DYNAMIC_LEN);
+  grub_test_assert (ret < 0 && grub_errno != GRUB_ERR_NONE,
+		    "truncated stream decoded to %" PRIdGRUB_SSIZE " bytes",
+		    ret);
+  grub_errno = GRUB_ERR_NONE;
+
+ out:
+  grub_free (text);
+  grub_free (out);
+}
+
+/* Register example_test method as a functional test.  */
+GRUB_FUNCTIONAL_TEST (inflate_test, inflate_test);
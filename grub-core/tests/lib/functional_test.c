@@ -63,6 +63,12 @@ grub_functional_all_tests (grub_extcmd_context_t ctxt __attribute__ ((unused)),
   grub_dl_load ("div_test");
   grub_dl_load ("xnu_uuid_test");
   grub_dl_load ("pbkdf2_test");
+  grub_dl_load ("aes_test");
+  grub_dl_load ("sha_test");
+  grub_dl_load ("crc_test");
+  grub_dl_load ("inflate_test");
+  grub_dl_load ("fdt_test");
+  grub_dl_load ("raid_gf_test");
   grub_dl_load ("signature_test");
   grub_dl_load ("sleep_test");
   grub_dl_load ("bswap_test");
@@ -177,6 +177,22 @@ grub_test_assert_helper (int cond, const char *file, const char *funp,
   grub_list_push (GRUB_AS_LIST_P (&failure_list), GRUB_AS_LIST (failure));
 }
 
+grub_uint32_t
+grub_test_random (grub_uint32_t *seed)
+{
+  *seed = *seed * 1103515245 + 12345;
+  return *seed >> 8;
+}
+
+void
+grub_test_fill_random (grub_uint32_t *seed, void *buf, grub_size_t size)
+{
+  grub_uint8_t *p = buf;
+
+  while (size--)
+    *p++ = grub_test_random (seed);
+}
+
 void
 grub_test_register (const char *name, void (*test_main) (void))
 {
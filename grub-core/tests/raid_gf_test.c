@@ -0,0 +1,164 @@
+/*
+ *  GRUB  --  GRand Unified Bootloader
+ *  Copyright (C) 2024  Free Software Foundation, Inc.
+ *
+ *  GRUB is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  GRUB is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with GRUB.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <grub/test.h>
+#include <grub/dl.h>
+#include <grub/misc.h>
+#include <grub/mm.h>
+#include <grub/disk.h>
+#include <grub/diskfilter.h>
+
+GRUB_MOD_LICENSE ("GPLv3+");
+
+#define MAX_DATA	16
+#define BLOCK_SIZE	65536
+#define RANDOM_RUNS	100
+
+/* The log/exp tables raid6rec used to multiply with, as the reference.  */
+static grub_uint8_t powx[255 * 2];
+static unsigned powx_inv[256];
+
+static void
+init_powx (void)
+{
+  grub_uint8_t cur = 1;
+  unsigned i;
+
+  for (i = 0; i < 255; i++)
+    {
+      powx[i] = cur;
+      powx[i + 255] = cur;
+      powx_inv[cur] = i;
+      if (cur & 0x80)
+	cur = (cur << 1) ^ 0x1d;
+      else
+	cur <<= 1;
+    }
+}
+
+static void
+mulx_ref (unsigned mul, char *buf, grub_size_t size)
+{
+  grub_uint8_t *p = (grub_uint8_t *) buf;
+  grub_size_t i;
+
+  for (i = 0; i < size; i++, p++)
+    if (*p)
+      *p = powx[mul + powx_inv[*p]];
+}
+
+static void
+xor_ref (char *dst, const char *src, grub_size_t size)
+{
+  grub_size_t i;
+
+  for (i = 0; i < size; i++)
+    dst[i] ^= src[i];
+}
+
+/* P and Q the way raid6rec computed them, one member and byte at a time.  */
+static void
+syndrome_ref (char **data, unsigned ndata, char *p, char *q, char *tmp,
+	      grub_size_t size)
+{
+  unsigned i;
+
+  grub_memset (p, 0, size);
+  grub_memset (q, 0, size);
+  for (i = 0; i < ndata; i++)
+    {
+      if (!data[i])
+	continue;
+      xor_ref (p, data[i], size);
+      grub_memcpy (tmp, data[i], size);
+      mulx_ref (i, tmp, size);
+      xor_ref (q, tmp, size);
+    }
+}
+
+static void
+raid_gf_test (void)
+{
+  char *data[MAX_DATA];
+  char *blocks, *p, *q, *p_ref, *q_ref, *tmp;
+  grub_uint32_t seed = 1;
+  unsigned i, j;
+
+  init_powx ();
+
+  blocks = grub_malloc ((MAX_DATA + 5) * BLOCK_SIZE);
+  grub_test_assert (blocks != NULL, "out of memory");
+  if (!blocks)
+    return;
+  p = blocks + MAX_DATA * BLOCK_SIZE;
+  q = p + BLOCK_SIZE;
+  p_ref = q + BLOCK_SIZE;
+  q_ref = p_ref + BLOCK_SIZE;
+  tmp = q_ref + BLOCK_SIZE;
+  grub_test_fill_random (&seed, blocks, MAX_DATA * BLOCK_SIZE);
+
+  /* Every factor, on every byte value.  */
+  for (i = 0; i < 255; i++)
+    {
+      for (j = 0; j < 512; j++)
+	p[j] = j;
+      grub_memcpy (q, p, 512);
+      grub_raid6_mul (powx[i], p, 512);
+      mulx_ref (i, q, 512);
+      grub_test_assert (grub_memcmp (p, q, 512) == 0,
+			"multiplication by x**%u mismatch", i);
+    }
+  grub_raid6_mul (0, p, 512);
+  for (j = 0; j < 512 && !p[j]; j++);
+  grub_test_assert (j == 512, "multiplication by 0 mismatch");
+
+  for (i = 0; i < RANDOM_RUNS; i++)
+    {
+      unsigned ndata = grub_test_random (&seed) % MAX_DATA + 1;
+      grub_size_t size = (grub_test_random (&seed) % (BLOCK_SIZE / 512) + 1) * 512;
+      unsigned nsrc = 0;
+      char *src[MAX_DATA];
+
+      for (j = 0; j < ndata; j++)
+	{
+	  /* Leave out a few, as for the failed and the parity members.  */
+	  data[j] = (grub_test_random (&seed) % 4) ? blocks + j * BLOCK_SIZE : NULL;
+	  if (data[j])
+	    src[nsrc++] = data[j];
+	}
+
+      syndrome_ref (data, ndata, p_ref, q_ref, tmp, size);
+      grub_raid6_syndrome (data, ndata, p, q, size);
+      grub_test_assert (grub_memcmp (p, p_ref, size) == 0,
+			"P mismatch for %u members of %" PRIuGRUB_SIZE,
+			ndata, size);
+      grub_test_assert (grub_memcmp (q, q_ref, size) == 0,
+			"Q mismatch for %u members of %" PRIuGRUB_SIZE,
+			ndata, size);
+
+      grub_raid_xor (p, src, nsrc, size);
+      grub_test_assert (grub_memcmp (p, p_ref, size) == 0,
+			"XOR mismatch for %u members of %" PRIuGRUB_SIZE,
+			nsrc, size);
+    }
+
+  grub_free (blocks);
+}
+
+/* Register example_test method as a functional test.  */
+GRUB_FUNCTIONAL_TEST (raid_gf_test, raid_gf_test);
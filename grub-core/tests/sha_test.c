@@ -0,0 +1,150 @@
+/*
+ *  GRUB  --  GRand Unified Bootloader
+ *  Copyright (C) 2024  Free Software Foundation, Inc.
+ *
+ *  GRUB is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  GRUB is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with GRUB.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <grub/test.h>
+#include <grub/dl.h>
+#include <grub/misc.h>
+#include <grub/mm.h>
+#include <grub/crypto.h>
+
+GRUB_MOD_LICENSE ("GPLv3+");
+
+/* Covers every way the padding can fall across one or two blocks.  */
+#define MAX_LEN	300
+
+static const char msg1[] = "abc";
+static const char msg2[] =
+  "abcdbcdecdefdefgefghfghighijhijkijkljklmklmnlmnomnopnopq";
+
+static struct
+{
+  const char *name;
+  const gcry_md_spec_t *portable;
+  /* FIPS 180-2 digests of msg1 and msg2.  */
+  const char *digest1;
+  const char *digest2;
+} vectors[] = {
+  {
+    "SHA1", GRUB_MD_SHA1,
+    "\xa9\x99\x3e\x36\x47\x06\x81\x6a\xba\x3e\x25\x71\x78\x50\xc2\x6c"
+    "\x9c\xd0\xd8\x9d",
+    "\x84\x98\x3e\x44\x1c\x3b\xd2\x6e\xba\xae\x4a\xa1\xf9\x51\x29\xe5"
+    "\xe5\x46\x70\xf1"
+  },
+  {
+    "SHA224", GRUB_MD_SHA224,
+    "\x23\x09\x7d\x22\x34\x05\xd8\x22\x86\x42\xa4\x77\xbd\xa2\x55\xb3"
+    "\x2a\xad\xbc\xe4\xbd\xa0\xb3\xf7\xe3\x6c\x9d\xa7",
+    "\x75\x38\x8b\x16\x51\x27\x76\xcc\x5d\xba\x5d\xa1\xfd\x89\x01\x50"
+    "\xb0\xc6\x45\x5c\xb4\xf5\x8b\x19\x52\x52\x25\x25"
+  },
+  {
+    "SHA256", GRUB_MD_SHA256,
+    "\xba\x78\x16\xbf\x8f\x01\xcf\xea\x41\x41\x40\xde\x5d\xae\x22\x23"
+    "\xb0\x03\x61\xa3\x96\x17\x7a\x9c\xb4\x10\xff\x61\xf2\x00\x15\xad",
+    "\x24\x8d\x6a\x61\xd2\x06\x38\xb8\xe5\xc0\x26\x93\x0c\x3e\x60\x39"
+    "\xa3\x3c\xe4\x59\x64\xff\x21\x67\xf6\xec\xed\xd4\x19\xdb\x06\xc1"
+  }
+};
+
+/* Digest SIZE bytes of DATA into OUT, written in two pieces split at
+   SPLIT to go through the partial block buffering.  */
+static void
+digest (const gcry_md_spec_t *md, void *ctx, const grub_uint8_t *data,
+	grub_size_t size, grub_size_t split, grub_uint8_t *out)
+{
+  md->init (ctx);
+  md->write (ctx, data, split);
+  md->write (ctx, data + split, size - split);
+  md->final (ctx);
+  grub_memcpy (out, md->read (ctx), md->mdlen);
+}
+
+static void
+check_md (const gcry_md_spec_t *active, const gcry_md_spec_t *portable,
+	  const char *digest1, const char *digest2)
+{
+  grub_uint8_t data[MAX_LEN], out_a[GRUB_CRYPTO_MAX_MDLEN];
+  grub_uint8_t out_p[GRUB_CRYPTO_MAX_MDLEN];
+  void *ctx_a, *ctx_p;
+  grub_size_t len;
+
+  ctx_a = grub_malloc (active->contextsize);
+  ctx_p = grub_malloc (portable->contextsize);
+  grub_test_assert (ctx_a && ctx_p, "out of memory");
+  if (!ctx_a || !ctx_p)
+    goto out;
+
+  grub_test_assert (active->mdlen == portable->mdlen,
+		    "%s: digest length differs", active->name);
+
+  digest (active, ctx_a, (const grub_uint8_t *) msg1, sizeof (msg1) - 1, 1,
+	  out_a);
+  grub_test_assert (grub_memcmp (out_a, digest1, active->mdlen) == 0,
+		    "%s: digest of \"%s\" mismatch", active->name, msg1);
+  digest (active, ctx_a, (const grub_uint8_t *) msg2, sizeof (msg2) - 1, 0,
+	  out_a);
+  grub_test_assert (grub_memcmp (out_a, digest2, active->mdlen) == 0,
+		    "%s: digest of \"%s\" mismatch", active->name, msg2);
+
+  for (len = 0; len < MAX_LEN; len++)
+    data[len] = len * 31 + (len >> 3);
+
+  for (len = 0; len <= MAX_LEN; len++)
+    {
+      digest (active, ctx_a, data, len, len / 3, out_a);
+      digest (portable, ctx_p, data, len, len / 3, out_p);
+      grub_test_assert (grub_memcmp (out_a, out_p, active->mdlen) == 0,
+			"%s: digest of %" PRIuGRUB_SIZE
+			" bytes differs from the portable code",
+			active->name, len);
+    }
+
+ out:
+  grub_free (ctx_a);
+  grub_free (ctx_p);
+}
+
+static void
+sha_test (void)
+{
+  grub_size_t i;
+
+  /* Where there's no sha_hw or no SHA instructions the portable code is
+     checked against itself.  */
+  grub_dl_load ("sha_hw");
+  grub_errno = GRUB_ERR_NONE;
+
+  for (i = 0; i < ARRAY_SIZE (vectors); i++)
+    {
+      const gcry_md_spec_t *active;
+
+      active = grub_crypto_lookup_md_by_name (vectors[i].name);
+      grub_test_assert (active != NULL, "%s not found", vectors[i].name);
+      if (!active)
+	continue;
+
+      check_md (vectors[i].portable, vectors[i].portable,
+		vectors[i].digest1, vectors[i].digest2);
+      check_md (active, vectors[i].portable,
+		vectors[i].digest1, vectors[i].digest2);
+    }
+}
+
+/* Register example_test method as a functional test.  */
+GRUB_FUNCTIONAL_TEST (sha_test, sha_test);
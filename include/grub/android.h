@@ -32,6 +32,13 @@
 #define _ANDROID_H_
 
 typedef struct boot_img_hdr boot_img_hdr;
+typedef struct boot_img_hdr_v1 boot_img_hdr_v1;
+typedef struct boot_img_hdr_v2 boot_img_hdr_v2;
+typedef struct boot_img_hdr_v3 boot_img_hdr_v3;
+typedef struct boot_img_hdr_v4 boot_img_hdr_v4;
+typedef struct vendor_boot_img_hdr_v3 vendor_boot_img_hdr_v3;
+typedef struct vendor_boot_img_hdr_v4 vendor_boot_img_hdr_v4;
+typedef struct vendor_ramdisk_table_entry_v4 vendor_ramdisk_table_entry_v4;
 
 #define BOOT_MAGIC "ANDROID!"
 #define BOOT_MAGIC_SIZE 8
@@ -54,7 +61,8 @@ struct boot_img_hdr
 
   grub_uint32_t tags_addr;	/* physical addr for kernel tags */
   grub_uint32_t page_size;	/* flash page size we assume */
-  grub_uint32_t dt_size;	/* device_tree in bytes */
+  grub_uint32_t dt_size;	/* device_tree in bytes (v0),
+				   header_version (v1 and later) */
   grub_uint32_t unused;		/* future expansion: should be 0 */
   unsigned char name[BOOT_NAME_SIZE];	/* asciiz product name */
 
@@ -97,6 +105,161 @@ struct boot_img_hdr
 **    else: jump to kernel_addr
 */
 
+/*
+** Version 0 images built for Qualcomm devices keep the size of a dt.img
+** where later versions keep the header version, so only small values are
+** taken to be a version.
+*/
+#define BOOT_HEADER_VERSION_MAX 4
+#define boot_img_hdr_version(hdr) \
+  ((hdr)->dt_size <= BOOT_HEADER_VERSION_MAX ? (hdr)->dt_size : 0)
+
+struct boot_img_hdr_v1
+{
+  struct boot_img_hdr v0;
+
+  grub_uint32_t recovery_dtbo_size;	/* size in bytes */
+  grub_uint64_t recovery_dtbo_offset;	/* offset in boot image */
+  grub_uint32_t header_size;	/* size of boot image header in bytes */
+} GRUB_PACKED;
+
+struct boot_img_hdr_v2
+{
+  struct boot_img_hdr_v1 v1;
+
+  grub_uint32_t dtb_size;	/* size in bytes */
+  grub_uint64_t dtb_addr;	/* physical load addr */
+} GRUB_PACKED;
+
+/*
+** +---------------------+
+** | boot header         | 1 page
+** +---------------------+
+** | kernel              | n pages
+** +---------------------+
+** | ramdisk             | m pages
+** +---------------------+
+** | second stage        | o pages
+** +---------------------+
+** | recovery dtbo (v1+) | p pages
+** +---------------------+
+** | dtb (v2+)           | q pages
+** +---------------------+
+*/
+
+#define BOOT_IMAGE_HEADER_V3_PAGESIZE 4096
+#define BOOT_ARGS_SIZE_V3 1536
+
+struct boot_img_hdr_v3
+{
+  unsigned char magic[BOOT_MAGIC_SIZE];
+
+  grub_uint32_t kernel_size;	/* size in bytes */
+  grub_uint32_t ramdisk_size;	/* size in bytes */
+
+  grub_uint32_t os_version;
+  grub_uint32_t header_size;	/* size of boot image header in bytes */
+  grub_uint32_t reserved[4];
+
+  grub_uint32_t header_version;	/* same offset as in v0 - v2 */
+
+  unsigned char cmdline[BOOT_ARGS_SIZE_V3];
+};
+
+struct boot_img_hdr_v4
+{
+  struct boot_img_hdr_v3 v3;
+
+  grub_uint32_t signature_size;	/* size in bytes */
+};
+
+/*
+** +---------------------+
+** | boot header         | 4096 bytes
+** +---------------------+
+** | kernel              | n pages
+** +---------------------+
+** | ramdisk             | m pages
+** +---------------------+
+** | boot signature (v4) | o pages
+** +---------------------+
+**
+** Page size is fixed to 4096 bytes. Load addresses come from the
+** vendor_boot image.
+*/
+
+#define VENDOR_BOOT_MAGIC "VNDRBOOT"
+#define VENDOR_BOOT_MAGIC_SIZE 8
+#define VENDOR_BOOT_ARGS_SIZE 2048
+#define VENDOR_BOOT_NAME_SIZE 16
+
+struct vendor_boot_img_hdr_v3
+{
+  unsigned char magic[VENDOR_BOOT_MAGIC_SIZE];
+  grub_uint32_t header_version;
+  grub_uint32_t page_size;	/* flash page size we assume */
+
+  grub_uint32_t kernel_addr;	/* physical load addr */
+  grub_uint32_t ramdisk_addr;	/* physical load addr */
+
+  grub_uint32_t vendor_ramdisk_size;	/* size in bytes */
+
+  unsigned char cmdline[VENDOR_BOOT_ARGS_SIZE];
+
+  grub_uint32_t tags_addr;	/* physical addr for kernel tags */
+  unsigned char name[VENDOR_BOOT_NAME_SIZE];	/* asciiz product name */
+
+  grub_uint32_t header_size;	/* size of vendor boot header in bytes */
+
+  grub_uint32_t dtb_size;	/* size in bytes */
+  grub_uint64_t dtb_addr;	/* physical load addr */
+} GRUB_PACKED;
+
+struct vendor_boot_img_hdr_v4
+{
+  struct vendor_boot_img_hdr_v3 v3;
+
+  grub_uint32_t vendor_ramdisk_table_size;	/* size in bytes */
+  grub_uint32_t vendor_ramdisk_table_entry_num;
+  grub_uint32_t vendor_ramdisk_table_entry_size;	/* size in bytes */
+  grub_uint32_t bootconfig_size;	/* size in bytes */
+} GRUB_PACKED;
+
+#define VENDOR_RAMDISK_TYPE_NONE 0
+#define VENDOR_RAMDISK_TYPE_PLATFORM 1
+#define VENDOR_RAMDISK_TYPE_RECOVERY 2
+#define VENDOR_RAMDISK_TYPE_DLKM 3
+
+#define VENDOR_RAMDISK_NAME_SIZE 32
+#define VENDOR_RAMDISK_TABLE_ENTRY_BOARD_ID_SIZE 16
+
+struct vendor_ramdisk_table_entry_v4
+{
+  grub_uint32_t ramdisk_size;	/* size in bytes */
+  grub_uint32_t ramdisk_offset;	/* offset in the vendor ramdisk section */
+  grub_uint32_t ramdisk_type;	/* VENDOR_RAMDISK_TYPE_* */
+  unsigned char ramdisk_name[VENDOR_RAMDISK_NAME_SIZE];	/* asciiz */
+  grub_uint32_t board_id[VENDOR_RAMDISK_TABLE_ENTRY_BOARD_ID_SIZE];
+};
+
+/*
+** +------------------------+
+** | vendor boot header     | o pages
+** +------------------------+
+** | vendor ramdisk section | p pages
+** +------------------------+
+** | dtb                    | q pages
+** +------------------------+
+** | ramdisk table (v4)     | r pages
+** +------------------------+
+** | bootconfig (v4)        | s pages
+** +------------------------+
+**
+** o = (header_size + page_size - 1) / page_size
+** The final ramdisk is the vendor ramdisk fragments followed by the
+** generic ramdisk from the boot image.
+*/
+
 #define KERNEL64_HDR_MAGIC 0x644D5241	/* ARM64 */
 #define IS_ARM64(ptr) (((struct kernel64_hdr*)(ptr))->magic_64 == KERNEL64_HDR_MAGIC)
 
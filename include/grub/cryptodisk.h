@@ -84,6 +84,8 @@ struct grub_cryptodisk
   grub_uint8_t *lrw_precalc;
   grub_uint8_t iv_prefix[64];
   grub_size_t iv_prefix_len;
+  /* IV_HASH state after IV_PREFIX, followed by room for a copy of it.  */
+  void *iv_hash_ctx;
   grub_uint8_t key[GRUB_CRYPTODISK_MAX_KEYLEN];
   grub_size_t keysize;
 #ifdef GRUB_UTIL
@@ -139,6 +141,17 @@ grub_cryptodisk_decrypt (struct grub_cryptodisk *dev,
 grub_err_t
 grub_cryptodisk_insert (grub_cryptodisk_t newdev, const char *name,
 			grub_disk_t source);
+
+/* Load the modules crypto.lst lists for NAME even if an implementation is
+   registered already, which the lookup wouldn't. This lets accelerated
+   ones like aes_hw register over the generic one before NAME is looked
+   up.  */
+static inline void
+grub_cryptodisk_request_crypto (const char *name)
+{
+  if (grub_crypto_autoload_hook)
+    grub_crypto_autoload_hook (name);
+}
 #ifdef GRUB_UTIL
 grub_err_t
 grub_cryptodisk_cheat_insert (grub_cryptodisk_t newdev, const char *name,
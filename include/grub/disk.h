@@ -135,6 +135,12 @@ struct grub_disk
   /* The partition information. This is machine-specific.  */
   struct grub_partition *partition;
 
+  /* Sequential read-ahead state: the last cache block read and the
+     number of cache blocks to read ahead on the next miss, 0 while the
+     accesses aren't sequential.  */
+  grub_disk_addr_t ra_last;
+  unsigned int ra_window;
+
   /* Called when a sector was read. OFFSET is between 0 and
      the sector size minus 1, and LENGTH is between 0 and the sector size.  */
   grub_disk_read_hook_t read_hook;
@@ -160,14 +166,27 @@ typedef struct grub_disk_memberlist *grub_disk_memberlist_t;
 #define GRUB_DISK_SECTOR_SIZE	0x200
 #define GRUB_DISK_SECTOR_BITS	9
 
-/* The maximum number of disk caches.  */
-#define GRUB_DISK_CACHE_NUM	1021
+/* The disk cache is set associative, see kern/disk.c. The number of sets
+   is a power of two picked so the cache can take up to 1 /
+   GRUB_DISK_CACHE_HEAP_SHARE of the heap.  */
+#define GRUB_DISK_CACHE_WAYS	8
+#define GRUB_DISK_CACHE_MIN_SETS	32
+#define GRUB_DISK_CACHE_MAX_SETS	4096
+#define GRUB_DISK_CACHE_DEFAULT_SETS	128
+#define GRUB_DISK_CACHE_HEAP_SHARE	4
 
 /* The size of a disk cache in 512B units. Must be at least as big as the
    largest supported sector size, currently 16K.  */
 #define GRUB_DISK_CACHE_BITS	6
 #define GRUB_DISK_CACHE_SIZE	(1 << GRUB_DISK_CACHE_BITS)
 
+/* Read-ahead window in cache blocks. It starts at GRUB_DISK_READAHEAD_MIN
+   once sequential access is seen and doubles with every window read, up
+   to GRUB_DISK_READAHEAD_MAX (4MiB) or the agglomerate limit of the
+   disk, whichever is lower.  */
+#define GRUB_DISK_READAHEAD_MIN	4
+#define GRUB_DISK_READAHEAD_MAX	128
+
 #define GRUB_DISK_MAX_MAX_AGGLOMERATE ((1 << (30 - GRUB_DISK_CACHE_BITS - GRUB_DISK_SECTOR_BITS)) - 1)
 
 /* Return value of grub_disk_get_size() in case disk size is unknown. */
@@ -213,10 +232,9 @@ extern grub_err_t (*EXPORT_VAR(grub_disk_write_weak)) (grub_disk_t disk,
 
 grub_uint64_t EXPORT_FUNC(grub_disk_get_size) (grub_disk_t disk);
 
-#if DISK_CACHE_STATS
-void
-EXPORT_FUNC(grub_disk_cache_get_performance) (unsigned long *hits, unsigned long *misses);
-#endif
+void EXPORT_FUNC(grub_disk_cache_invalidate) (unsigned long dev_id,
+					      unsigned long disk_id,
+					      grub_disk_addr_t sector);
 
 extern void (* EXPORT_VAR(grub_disk_firmware_fini)) (void);
 extern int EXPORT_VAR(grub_disk_firmware_is_tainted);
@@ -241,9 +259,30 @@ struct grub_disk_cache
   grub_disk_addr_t sector;
   char *data;
   int lock;
+  unsigned long last_use;
 };
 
-extern struct grub_disk_cache EXPORT_VAR(grub_disk_cache_table)[GRUB_DISK_CACHE_NUM];
+extern struct grub_disk_cache *EXPORT_VAR(grub_disk_cache_table);
+extern unsigned EXPORT_VAR(grub_disk_cache_sets);
+
+#if DISK_CACHE_STATS
+/* Cache statistics of one disk.  */
+struct grub_disk_cache_stats
+{
+  int used;
+  enum grub_disk_dev_id dev_id;
+  unsigned long disk_id;
+  unsigned long hits;
+  unsigned long misses;
+  /* Blocks of this disk pushed out of the cache by other ones.  */
+  unsigned long evictions;
+};
+
+#define GRUB_DISK_CACHE_STATS_MAX	16
+
+extern struct grub_disk_cache_stats
+EXPORT_VAR(grub_disk_cache_stats)[GRUB_DISK_CACHE_STATS_MAX];
+#endif
 
 #if defined (GRUB_UTIL)
 void grub_lvm_init (void);
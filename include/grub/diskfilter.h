@@ -189,6 +189,20 @@ typedef grub_err_t (*grub_raid6_recover_func_t) (struct grub_diskfilter_segment
 extern grub_raid5_recover_func_t grub_raid5_recover_func;
 extern grub_raid6_recover_func_t grub_raid6_recover_func;
 
+/* Block arithmetic for the recovery modules, in raid_gf. The buffers
+   must be aligned as by grub_malloc and SIZE a multiple of 32.  */
+
+/* DST = SRC[0] ^ ... ^ SRC[NSRC - 1]. DST may be SRC[0].  */
+void grub_raid_xor (char *dst, char **src, unsigned nsrc, grub_size_t size);
+
+/* P and Q syndromes of NDATA blocks, DATA[i] having coefficient x**i.
+   Missing blocks are NULL and count as zero. P may be NULL.  */
+void grub_raid6_syndrome (char **data, unsigned ndata, char *p, char *q,
+			  grub_size_t size);
+
+/* Multiply every byte of BUF by FACTOR in GF(2^8).  */
+void grub_raid6_mul (grub_uint8_t factor, char *buf, grub_size_t size);
+
 grub_err_t grub_diskfilter_vg_register (struct grub_diskfilter_vg *vg);
 
 grub_err_t
@@ -103,6 +103,8 @@ int grub_fdt_find_subnode (const void *fdt, unsigned int parentoffset,
 int grub_fdt_add_subnode (void *fdt, unsigned int parentoffset,
 			  const char *name);
 
+const void *grub_fdt_get_prop (const void *fdt, unsigned int nodeoffset,
+			       const char *name, grub_uint32_t *len);
 int grub_fdt_set_prop (void *fdt, unsigned int nodeoffset, const char *name,
 		      const void *val, grub_uint32_t len);
 #define grub_fdt_set_prop32(fdt, nodeoffset, name, val)	\
@@ -117,4 +119,32 @@ int grub_fdt_set_prop (void *fdt, unsigned int nodeoffset, const char *name,
   grub_fdt_set_prop ((fdt), (nodeoffset), (name), &_val, 8);   \
 })
 
+/* Editing sessions, for making several edits to a tree at once.  */
+typedef struct grub_fdt_edit *grub_fdt_edit_t;
+
+grub_fdt_edit_t grub_fdt_edit_begin (const void *fdt);
+void grub_fdt_edit_free (grub_fdt_edit_t edit);
+int grub_fdt_edit_find_subnode (grub_fdt_edit_t edit, int parent,
+				const char *name);
+int grub_fdt_edit_add_subnode (grub_fdt_edit_t edit, int parent,
+			       const char *name);
+int grub_fdt_edit_set_prop (grub_fdt_edit_t edit, int node, const char *name,
+			    const void *val, grub_uint32_t len);
+int grub_fdt_edit_del_prop (grub_fdt_edit_t edit, int node, const char *name);
+int grub_fdt_edit_del_node (grub_fdt_edit_t edit, int node);
+grub_uint32_t grub_fdt_edit_get_size (grub_fdt_edit_t edit);
+int grub_fdt_edit_commit (grub_fdt_edit_t edit, void *fdt, unsigned int size);
+
+#define grub_fdt_edit_set_prop32(edit, node, name, val)	\
+({ \
+  grub_uint32_t _val = grub_cpu_to_be32(val); \
+  grub_fdt_edit_set_prop ((edit), (node), (name), &_val, 4);	\
+})
+
+#define grub_fdt_edit_set_prop64(edit, node, name, val)	\
+({ \
+  grub_uint64_t _val = grub_cpu_to_be64(val); \
+  grub_fdt_edit_set_prop ((edit), (node), (name), &_val, 8);	\
+})
+
 #endif	/* ! GRUB_FDT_HEADER */
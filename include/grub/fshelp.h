@@ -77,4 +77,23 @@ EXPORT_FUNC(grub_fshelp_read_file) (grub_disk_t disk, grub_fshelp_node_t node,
 				    grub_off_t filesize, int log2blocksize,
 				    grub_disk_addr_t blocks_start);
 
+/* Like grub_fshelp_read_file, but GET_EXTENT maps a whole run of file
+   blocks at once: it returns the disk block of file block BLOCK and
+   stores in COUNT how many blocks from BLOCK on follow each other on disk
+   (or are all holes, when it returns 0). Contiguous runs are read from
+   the disk with a single call.  */
+grub_ssize_t
+EXPORT_FUNC(grub_fshelp_read_file_extents) (grub_disk_t disk,
+					    grub_fshelp_node_t node,
+					    grub_disk_read_hook_t read_hook,
+					    void *read_hook_data,
+					    grub_off_t pos, grub_size_t len,
+					    char *buf,
+					    grub_disk_addr_t (*get_extent) (grub_fshelp_node_t node,
+									    grub_disk_addr_t block,
+									    grub_disk_addr_t *count),
+					    grub_off_t filesize,
+					    int log2blocksize,
+					    grub_disk_addr_t blocks_start);
+
 #endif /* ! GRUB_FSHELP_HEADER */
@@ -0,0 +1 @@
+../../../grub-core/lib/libgcrypt-grub/src/g10lib.h
\ No newline at end of file
@@ -0,0 +1,107 @@
+/*
+ *  GRUB  --  GRand Unified Bootloader
+ *  Copyright (C) 2024  Free Software Foundation, Inc.
+ *
+ *  GRUB is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  GRUB is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with GRUB.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef GRUB_INFLATE_HEADER
+#define GRUB_INFLATE_HEADER 1
+
+#include <grub/types.h>
+#include <grub/err.h>
+
+/* The deflate window, output is produced one window at a time.  */
+#define GRUB_INFLATE_WSIZE		0x8000
+/* Matches are copied 8 bytes at a time and may write this much past
+   their end.  */
+#define GRUB_INFLATE_SLACK		8
+
+/* Bits resolved by the first table lookup, longer codes take a second
+   one.  */
+#define GRUB_INFLATE_LITLEN_BITS	11
+#define GRUB_INFLATE_DIST_BITS		8
+
+/* Room for the first level and the worst case of second level tables of a
+   complete code, see build_table.  */
+#define GRUB_INFLATE_LITLEN_ENOUGH	((1 << GRUB_INFLATE_LITLEN_BITS) + 1024)
+#define GRUB_INFLATE_DIST_ENOUGH	((1 << GRUB_INFLATE_DIST_BITS) + 512)
+
+struct grub_inflate
+{
+  /* Called when IN is used up to point it at more data. Returns the
+     number of bytes available, 0 at the end of input or -1 on error. If
+     NULL, IN is all there is.  */
+  grub_ssize_t (*read) (struct grub_inflate *inf);
+  void *read_data;
+  const grub_uint8_t *in;
+  grub_size_t in_avail;
+
+  /* Input bytes consumed since grub_inflate_init, those in BITS
+     included.  */
+  grub_uint64_t total_in;
+  /* The bit buffer. Bits above NBITS are either zero or the following
+     input bits.  */
+  grub_uint64_t bits;
+  unsigned nbits;
+  /* Zero bytes added to BITS past the end of input.  */
+  unsigned pad;
+
+  /* TOTAL_IN, BITS and NBITS at the start of the current block header.  */
+  grub_uint64_t block_in;
+  grub_uint64_t block_bits;
+  unsigned block_nbits;
+
+  int last_block;
+  int block_type;
+  /* Non-zero inside a block, for stored blocks the bytes left in it.  */
+  grub_uint32_t block_len;
+  /* The rest of a match which didn't fit in the window.  */
+  unsigned copy_len;
+  unsigned copy_dist;
+
+  /* Decoding tables of the current block.  */
+  const grub_uint32_t *litlen_table;
+  const grub_uint32_t *dist_table;
+  grub_uint32_t litlen[GRUB_INFLATE_LITLEN_ENOUGH];
+  grub_uint32_t dist[GRUB_INFLATE_DIST_ENOUGH];
+
+  /* The previous window, followed by the one being decoded and room for
+     copies running over its end.  */
+  grub_uint8_t buf[2 * GRUB_INFLATE_WSIZE + GRUB_INFLATE_SLACK];
+  /* How much of the window the last grub_inflate_window call filled.  */
+  unsigned wp;
+};
+
+/* Reset the decoder to the start of a raw deflate stream. The input
+   fields and the window are left alone.  */
+void grub_inflate_init (struct grub_inflate *inf);
+
+/* Decode the next GRUB_INFLATE_WSIZE bytes into the window. On return WP
+   is the number of bytes produced, less than a full window only at the
+   end of the stream.  */
+grub_err_t grub_inflate_window (struct grub_inflate *inf);
+
+/* Read a block header and set up its tables. Only needed to resume in the
+   middle of a block, grub_inflate_window reads headers itself.  */
+grub_err_t grub_inflate_read_header (struct grub_inflate *inf);
+
+/* The window, the last GRUB_INFLATE_WSIZE bytes of output.  */
+static inline grub_uint8_t *
+grub_inflate_output (struct grub_inflate *inf)
+{
+  return inf->buf + GRUB_INFLATE_WSIZE;
+}
+
+#endif
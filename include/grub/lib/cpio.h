@@ -48,6 +48,7 @@ grub_size_t cpio_predict_obj_size (grub_uint32_t namesize,
 				   grub_uint32_t filesize);
 grub_size_t cpio_get_obj_size (cpio_newc_header_t * hdr);
 cpio_newc_header_t *cpio_get_last (cpio_newc_header_t * hdr);
+cpio_newc_header_t *cpio_find_trailer (void *start, grub_size_t size);
 
 cpio_newc_header_t *cpio_create_obj (cpio_newc_header_t * hdr,
 				     const char *name, const void *data,
@@ -0,0 +1,32 @@
+/* lz4.h - prototypes for the raw lz4 block decoder */
+/*
+ *  GRUB  --  GRand Unified Bootloader
+ *  Copyright (C) 2024  Free Software Foundation, Inc.
+ *
+ *  GRUB is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  GRUB is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with GRUB.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef GRUB_LZ4_H
+#define GRUB_LZ4_H	1
+
+#include <grub/types.h>
+
+/* Decompress a raw lz4 block of SRC_LEN bytes, without the size prefix
+   used by ZFS, into at most DEST_LEN bytes at DEST.  Returns the number
+   of bytes written or a negative value on corrupted input.  In
+   fs/zfs/zfs_lz4.c.  */
+int lz4_decompress_block (const void *src, void *dest, grub_size_t src_len,
+			  grub_size_t dest_len);
+
+#endif /* ! GRUB_LZ4_H */
@@ -79,6 +79,10 @@ struct grub_net_card_driver
   grub_err_t (*send) (struct grub_net_card *dev,
 		      struct grub_net_buff *buf);
   struct grub_net_buff * (*recv) (struct grub_net_card *dev);
+  /* Optional. Receive up to MAX frames into BUFS and return how many were
+     received, 0 if none is pending. Used instead of recv when set.  */
+  unsigned (*recv_batch) (struct grub_net_card *dev,
+			  struct grub_net_buff **bufs, unsigned max);
 };
 
 typedef struct grub_net_packet
@@ -128,8 +132,9 @@ struct grub_net_card
   grub_ssize_t new_ll_entry;
   struct grub_net_link_layer_entry *link_layer_table;
   void *txbuf;
-  void *rcvbuf;
   grub_size_t rcvbufsize;
+  /* Receive buffers, if the driver uses them. Freed on unregister.  */
+  struct grub_net_buff_pool *rcvpool;
   grub_size_t txbufsize;
   int txbusy;
   union
@@ -507,6 +512,10 @@ grub_net_network_level_interface_unregister (struct grub_net_network_level_inter
 void
 grub_net_tcp_retransmit (void);
 
+/* Send the ACKs held back while a burst of segments was received.  */
+void
+grub_net_tcp_flush_acks (void);
+
 void
 grub_net_link_layer_add_address (struct grub_net_card *card,
 				 const grub_net_network_level_address_t *nl,
@@ -537,5 +546,7 @@ extern char *grub_net_default_server;
 #define GRUB_NET_TRIES 40
 #define GRUB_NET_INTERVAL 400
 #define GRUB_NET_INTERVAL_ADDITION 20
+/* Idle receive buffers kept per card.  */
+#define GRUB_NET_RCV_POOL_SIZE 64
 
 #endif /* ! GRUB_NET_HEADER */
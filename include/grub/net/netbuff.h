@@ -16,6 +16,24 @@ struct grub_net_buff
   grub_uint8_t *tail;
   /* Pointer to the end of the buffer.  */
   grub_uint8_t *end;
+  /* Pool the buffer is returned to when freed, or NULL.  */
+  struct grub_net_buff_pool *pool;
+  /* Next free buffer in the pool.  */
+  struct grub_net_buff *next_free;
+};
+
+/* Preallocated receive buffers of a card. Drivers receive straight into
+   them and grub_netbuff_free puts them back for the next frame.  */
+struct grub_net_buff_pool
+{
+  struct grub_net_buff *free;
+  unsigned n_free;
+  /* Idle buffers kept beyond this are returned to the heap.  */
+  unsigned max_free;
+  grub_size_t buf_size;
+  /* Buffers currently handed out.  */
+  unsigned in_use;
+  int destroyed;
 };
 
 grub_err_t grub_netbuff_put (struct grub_net_buff *net_buff, grub_size_t len);
@@ -27,5 +45,9 @@ grub_err_t grub_netbuff_clear (struct grub_net_buff *net_buff);
 struct grub_net_buff * grub_netbuff_alloc (grub_size_t len);
 struct grub_net_buff * grub_netbuff_make_pkt (grub_size_t len);
 void grub_netbuff_free (struct grub_net_buff *net_buff);
+struct grub_net_buff_pool *grub_netbuff_pool_new (unsigned count,
+						  grub_size_t len);
+struct grub_net_buff *grub_netbuff_pool_get (struct grub_net_buff_pool *pool);
+void grub_netbuff_pool_destroy (struct grub_net_buff_pool *pool);
 
 #endif
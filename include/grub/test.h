@@ -70,6 +70,13 @@ void grub_test_assert_helper (int cond, const char *file,
   grub_test_assert_helper(cond, GRUB_FILE, __FUNCTION__, __LINE__,     \
                          #cond, ## __VA_ARGS__);
 
+/* Return the next value of a fixed pseudo-random sequence, the same on
+   every run, kept in `seed'.  */
+grub_uint32_t grub_test_random (grub_uint32_t *seed);
+
+/* Fill `buf' with `size' bytes from the sequence kept in `seed'.  */
+void grub_test_fill_random (grub_uint32_t *seed, void *buf, grub_size_t size);
+
 void grub_unit_test_init (void);
 void grub_unit_test_fini (void);
 
@@ -400,10 +400,39 @@ push_partmap_module (const char *map, void *data __attribute__ ((unused)))
   grub_install_push_module (buf);
 }
 
+/* Faster implementations registering over the generic crypto modules.
+   They're only built for some platforms.  */
+static const struct
+{
+  const char *generic;
+  const char *accel;
+} crypto_accel_modules[] =
+  {
+    { "gcry_rijndael", "aes_hw" },
+    { "gcry_sha1", "sha_hw" },
+    { "gcry_sha256", "sha_hw" }
+  };
+
 static void
 push_cryptodisk_module (const char *mod, void *data __attribute__ ((unused)))
 {
+  unsigned i;
+
   grub_install_push_module (mod);
+
+  for (i = 0; i < ARRAY_SIZE (crypto_accel_modules); i++)
+    {
+      char *path;
+
+      if (strcmp (mod, crypto_accel_modules[i].generic) != 0)
+	continue;
+      path = grub_util_path_concat_ext (2, grub_install_source_directory,
+					crypto_accel_modules[i].accel,
+					".mod");
+      if (grub_util_is_regular (path))
+	grub_install_push_module (crypto_accel_modules[i].accel);
+      free (path);
+    }
 }
 
 static void
@@ -96,6 +96,17 @@ cryptolist.write ("AES-128: gcry_rijndael\n");
 cryptolist.write ("AES-192: gcry_rijndael\n");
 cryptolist.write ("AES-256: gcry_rijndael\n");
 
+# aes_hw registers faster AES specs on top of gcry_rijndael's when the CPU
+# has AES instructions. It only exists on some platforms, where it's
+# missing the load just fails.
+for name in ["AES", "AES128", "AES-128", "RIJNDAEL", "AES192", "AES-192",
+             "RIJNDAEL192", "AES256", "AES-256", "RIJNDAEL256"]:
+    cryptolist.write ("%s: aes_hw\n" % name);
+
+# Likewise sha_hw for gcry_sha1 and gcry_sha256.
+for name in ["SHA1", "SHA224", "SHA256"]:
+    cryptolist.write ("%s: sha_hw\n" % name);
+
 cryptolist.write ("ADLER32: adler32\n");
 cryptolist.write ("CRC64: crc64\n");
 